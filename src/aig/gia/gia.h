@@ -42,8 +42,19 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// by default, the objects take 12 bytes and the fanin differences have 29 bits,
+// which limits the AIG to 2^29 objects; compiling with ABC_GIA_WIDE_OBJS gives
+// 16-byte objects with 31-bit differences, which allows 2^30 objects (the largest
+// number of objects whose literals fit into int)
+#ifdef ABC_GIA_WIDE_OBJS
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_OBJ_LOG 30
+#else
 #define GIA_NONE 0x1FFFFFFF
+#define GIA_OBJ_LOG 29
+#endif
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_HASH_SLOT 3           // the number of entries in a slot of the hash table
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -76,6 +87,19 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_GIA_WIDE_OBJS
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       Unused :  28;  // unused
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -85,6 +109,7 @@ struct Gia_Obj_t_
     unsigned       fCompl1:   1;  // the complemented attribute
     unsigned       fMark1 :   1;  // second user-controlled mark
     unsigned       fPhase :   1;  // value under 000 pattern
+#endif
 
     unsigned       Value;         // application-specific value
 };
@@ -104,13 +129,15 @@ struct Gia_Man_t_
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
     unsigned *     pMuxes;        // control signals of MUXes
+    char *         pSnapMap;      // memory-mapped snapshot holding the objects
+    size_t         nSnapMap;      // the size of the mapped snapshot
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
-    Vec_Int_t      vHTable;       // hash table
+    int *          pHTable;       // hash table (nHTable slots of GIA_HASH_SLOT entries)
+    int            nHTable;       // the number of slots in the hash table
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -133,6 +160,9 @@ struct Gia_Man_t_
     int            nFansAlloc;    // the size of fanout representation
     Vec_Int_t *    vFanoutNums;   // static fanout
     Vec_Int_t *    vFanout;       // static fanout
+    int            fFanoutKeep;   // static fanout is owned by the manager and updated incrementally
+    int            nFanoutObjs;   // the number of objects covered by the kept static fanout (0 if invalid)
+    int            nFanoutSlots;  // the number of offsets reserved in front of the kept fanout edges
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -676,17 +706,23 @@ static inline word *       Gia_ObjSimObj( Gia_Man_t * p, Gia_Obj_t * pObj )    {
 
 // AIG construction
 extern void Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void Gia_ObjAddFanoutStatic( Gia_Man_t * p, Gia_Obj_t * pObj );
+extern void Gia_ManStaticFanoutInvalidate( Gia_Man_t * p );
+extern void Gia_ManSnapRelease( Gia_Man_t * p );
 static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )  
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew;
+        if ( p->nObjs == (1 << GIA_OBJ_LOG) )
+            printf( "Hard limit on the number of nodes (2^%d) is reached. Quitting...\n", GIA_OBJ_LOG ), exit(1);
+        nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << GIA_OBJ_LOG) );
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
+        if ( p->pSnapMap )
+            Gia_ManSnapRelease( p );
         p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
         memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
         if ( p->pMuxes )
@@ -696,7 +732,6 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -706,6 +741,8 @@ static inline int Gia_ManAppendCi( Gia_Man_t * p )
     pObj->iDiff0 = GIA_NONE;
     pObj->iDiff1 = Vec_IntSize( p->vCis );
     Vec_IntPush( p->vCis, Gia_ObjId(p, pObj) );
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 
@@ -737,6 +774,8 @@ static inline int Gia_ManAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
         Gia_ObjAddFanout( p, Gia_ObjFanin1(pObj), pObj );
     }
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     if ( p->fSweeper )
     {
         Gia_Obj_t * pFan0 = Gia_ObjFanin0(pObj);
@@ -779,6 +818,8 @@ static inline int Gia_ManAppendXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
     }
     p->nXors++;
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )  
@@ -791,7 +832,7 @@ static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int
     assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
     assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit0) );
     assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit1) );
-    assert( !Vec_IntSize(&p->vHTable) || !Abc_LitIsCompl(iLit1) );
+    assert( !p->nHTable || !Abc_LitIsCompl(iLit1) );
     if ( Abc_Lit2Var(iLit0) < Abc_Lit2Var(iLit1) )
     {
         pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
@@ -809,6 +850,8 @@ static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int
         p->pMuxes[Gia_ObjId(p, pObj)] = Abc_LitNot(iLitC);
     }
     p->nMuxes++;
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )  
@@ -818,6 +861,8 @@ static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )
     pObj->iDiff0  = pObj->iDiff1  = Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit);
     pObj->fCompl0 = pObj->fCompl1 = Abc_LitIsCompl(iLit);
     p->nBufs++;
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )  
@@ -833,6 +878,8 @@ static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )
     Vec_IntPush( p->vCos, Gia_ObjId(p, pObj) );
     if ( p->pFanData )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
+    if ( p->fFanoutKeep )
+        Gia_ObjAddFanoutStatic( p, pObj );
     return Gia_ObjId( p, pObj ) << 1;
 }
 static inline int Gia_ManAppendOr( Gia_Man_t * p, int iLit0, int iLit1 )
@@ -916,6 +963,8 @@ static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0
     assert( Gia_ObjId(p, pObjCo) > Abc_Lit2Var(iLit0) );
     pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
     pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
+    if ( p->fFanoutKeep )
+        Gia_ManStaticFanoutInvalidate( p );
 }
 
 #define GIA_ZER 1
@@ -1013,11 +1062,19 @@ static inline void Gia_AigerWriteInt( unsigned char * pPos, int Value )
 }
 static inline unsigned Gia_AigerReadUnsigned( unsigned char ** ppPos )
 {
-    unsigned x = 0, i = 0;
-    unsigned char ch;
-    while ((ch = *(*ppPos)++) & 0x80)
-        x |= (ch & 0x7f) << (7 * i++);
-    return x | (ch << (7 * i));
+    unsigned char * pPos = *ppPos;
+    unsigned x = pPos[0], i;
+    // the deltas of a topologically ordered AIG mostly take one or two bytes
+    if ( !(x & 0x80) )
+        return *ppPos = pPos + 1, x;
+    x = (x & 0x7f) | ((unsigned)pPos[1] << 7);
+    if ( !(pPos[1] & 0x80) )
+        return *ppPos = pPos + 2, x;
+    x &= 0x3fff;
+    for ( i = 2; pPos[i] & 0x80; i++ )
+        x |= (unsigned)(pPos[i] & 0x7f) << (7 * i);
+    *ppPos = pPos + i + 1;
+    return x | ((unsigned)pPos[i] << (7 * i));
 }
 static inline void Gia_AigerWriteUnsigned( Vec_Str_t * vStr, unsigned x )
 {
@@ -1273,6 +1330,8 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern char *              Gia_FileMap( char * pFileName, size_t nFileSize );
+extern void                Gia_FileUnmap( char * pContents, size_t nFileSize );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
@@ -1299,6 +1358,8 @@ extern void                Gia_ManCounterExampleValueStop( Gia_Man_t * pGia );
 extern int                 Gia_ManCounterExampleValueLookup( Gia_Man_t * pGia, int Id, int iFrame );
 extern Abc_Cex_t *         Gia_ManCexExtendToIncludeCurrentStates( Gia_Man_t * p, Abc_Cex_t * pCex );
 extern Abc_Cex_t *         Gia_ManCexExtendToIncludeAllObjects( Gia_Man_t * p, Abc_Cex_t * pCex );
+/*=== giaCnf.c ============================================================*/
+extern void *              Gia_ManCnfDeriveFast( Gia_Man_t * p, int fCnfObjIds, int fAddOrCla, int fVerbose );
 /*=== giaCsatOld.c ============================================================*/
 extern Vec_Int_t *         Cbs_ManSolveMiter( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== giaCsat.c ============================================================*/
@@ -1470,11 +1531,15 @@ extern void                Gia_ManQuantUpdateCiSupp( Gia_Man_t * p, int iObj );
 extern int                 Gia_ManQuantExist( Gia_Man_t * p, int iLit, int(*pFuncCiToKeep)(void *, int), void * pData );
 /*=== giaFanout.c =========================================================*/
 extern void                Gia_ObjAddFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
+extern void                Gia_ObjAddFanoutStatic( Gia_Man_t * p, Gia_Obj_t * pObj );
 extern void                Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanout );
 extern void                Gia_ManFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManFanoutStop( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStop( Gia_Man_t * p );
+extern void                Gia_ManStaticFanoutKeepStart( Gia_Man_t * p );
+extern void                Gia_ManStaticFanoutKeepStop( Gia_Man_t * p );
+extern void                Gia_ManStaticFanoutInvalidate( Gia_Man_t * p );
 extern void                Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex );
 /*=== giaForce.c =========================================================*/
 extern void                For_ManExperiment( Gia_Man_t * pGia, int nIters, int fClustered, int fVerbose );
@@ -1496,6 +1561,7 @@ extern Gia_Man_t *         Gia_ManPerformFx( Gia_Man_t * p, int nNewNodesMax, in
 /*=== giaHash.c ===========================================================*/
 extern void                Gia_ManHashAlloc( Gia_Man_t * p ); 
 extern void                Gia_ManHashStart( Gia_Man_t * p ); 
+extern int                 Gia_ManHashStartUnique( Gia_Man_t * p );
 extern void                Gia_ManHashStop( Gia_Man_t * p );
 extern int                 Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 );
@@ -1506,6 +1572,7 @@ extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1,
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
+extern int                 Gia_ManRehashInPlace( Gia_Man_t * p );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
@@ -1607,6 +1674,8 @@ extern int                 Sat_ManTest( Gia_Man_t * pGia, Gia_Obj_t * pObj, int
 extern int                 Gia_ManSeqMarkUsed( Gia_Man_t * p );
 extern int                 Gia_ManCombMarkUsed( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManCleanup( Gia_Man_t * p );
+extern int                 Gia_ManCanCompactInPlace( Gia_Man_t * p );
+extern Vec_Int_t *         Gia_ManCleanupInPlace( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManCleanupOutputs( Gia_Man_t * p, int nOutputs );
 extern Gia_Man_t *         Gia_ManSeqCleanup( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManSeqStructSweep( Gia_Man_t * p, int fConst, int fEquiv, int fVerbose );
@@ -1619,6 +1688,11 @@ extern Gia_Man_t *         Gia_ManMapShrink6( Gia_Man_t * p, int nFanoutMax, int
 extern Gia_Man_t *         Gia_ManExtractWindow( Gia_Man_t * p, int LevelMax, int nTimeWindow, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformSopBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nCutNum, int nRelaxRatio, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformDsdBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nLutSize, int nCutNum, int nRelaxRatio, int fVerbose );
+/*=== giaSnap.c ============================================================*/
+extern int                 Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName, int fVerbose );
+extern int                 Gia_ManSnapIsFile( char * pFileName );
+extern Gia_Man_t *         Gia_ManSnapRead( char * pFileName, int fVerbose );
+extern void                Gia_ManSnapUnmap( Gia_Man_t * p );
 /*=== giaSort.c ============================================================*/
 extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSize );
 /*=== giaSim.c ============================================================*/
@@ -1644,6 +1718,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern void                Gia_ManSimPatSimMt( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, Vec_Wrd_t * vSims, int fOuts, int nProcs );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -21,8 +21,25 @@
 
 #include "gia.h"
 #include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -83,6 +100,45 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     fwrite( Buffer, 1, 4, pFile );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The pages are private, so the reader can modify the buffer
+  without changing the file; only the modified pages take memory in
+  addition to the page cache. Returns NULL if mapping is not available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, size_t nFileSize )
+{
+#ifndef _WIN32
+    void * pContents;
+    int fd;
+    if ( nFileSize == 0 || (fd = open( pFileName, O_RDONLY )) < 0 )
+        return NULL;
+    pContents = mmap( NULL, nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, nFileSize, MADV_SEQUENTIAL );
+#endif
+    return (char *)pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileUnmap( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Create the array of literals to be written.]
@@ -162,28 +218,336 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Streaming reader of compressed AIGER files.]
+
+  Description [The file is decompressed in blocks of fixed size, which
+  are parsed as they arrive, so that the decompressed AND gates are never 
+  stored in memory. When pthreads are available, the next block is 
+  decompressed by a separate thread while the current one is parsed.
+  Only the text before the AND gates (the header and the driver lines) 
+  and the text after them (symbols and extensions) are kept in vData.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+
+#define GIA_STREAM_BLOCK  (1 << 20)   // the size of decompressed blocks
+#define GIA_STREAM_PAD    16          // the bytes after the window parsed without a check
+
+typedef struct Gia_AigerStream_t_ Gia_AigerStream_t;
+struct Gia_AigerStream_t_
+{
+    gzFile            pFile;          // the compressed file
+    Vec_Str_t *       vData;          // the text before and after the AND gates
+    int               nPrefix;        // the size of the text before the AND gates
+    unsigned char *   pWindow;        // the bytes currently parsed
+    unsigned char *   pCur;           // the current position in the window
+    unsigned char *   pEnd;           // the end of the bytes in the window
+    unsigned char *   pLimit;         // the window is refilled after this position
+    int               fEof;           // the file has no more bytes
+    // blocks decompressed by the thread
+    unsigned char *   pBlocks[2];     // the two blocks
+    int               nBlocks[2];     // the number of bytes in each block
+    int               nFull;          // the number of blocks waiting to be parsed
+    int               iNext;          // the next block to be parsed
+    int               fThread;        // the thread is running
+#ifdef ABC_USE_PTHREADS
+    pthread_t         Thread;         // the decompressing thread
+    pthread_mutex_t   Mutex;          // protects nFull
+    pthread_cond_t    Cond;           // signals the change of nFull
+#endif
+};
+
+#ifdef ABC_USE_PTHREADS
+static void * Gia_AigerStreamThread( void * pArg )
+{
+    Gia_AigerStream_t * p = (Gia_AigerStream_t *)pArg;
+    int iBlock = 0, nBytes;
+    do {
+        // wait for a free block
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nFull == 2 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        pthread_mutex_unlock( &p->Mutex );
+        // fill it and pass it to the parser
+        nBytes = gzread( p->pFile, p->pBlocks[iBlock], GIA_STREAM_BLOCK );
+        p->nBlocks[iBlock] = Abc_MaxInt( nBytes, 0 );
+        pthread_mutex_lock( &p->Mutex );
+        p->nFull++;
+        pthread_cond_signal( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+        iBlock ^= 1;
+    } while ( nBytes == GIA_STREAM_BLOCK );
+    return NULL;
+}
+#endif
+
+// reads the next block of decompressed bytes into pBuffer
+static int Gia_AigerStreamBlock( Gia_AigerStream_t * p, unsigned char * pBuffer )
+{
+    int nBytes;
+    if ( p->fEof )
+        return 0;
+    if ( !p->fThread )
+        nBytes = Abc_MaxInt( gzread( p->pFile, pBuffer, GIA_STREAM_BLOCK ), 0 );
+#ifdef ABC_USE_PTHREADS
+    else
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( p->nFull == 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        pthread_mutex_unlock( &p->Mutex );
+        nBytes = p->nBlocks[p->iNext];
+        memcpy( pBuffer, p->pBlocks[p->iNext], (size_t)nBytes );
+        p->iNext ^= 1;
+        pthread_mutex_lock( &p->Mutex );
+        p->nFull--;
+        pthread_cond_signal( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+#endif
+    p->fEof = (nBytes < GIA_STREAM_BLOCK);
+    return nBytes;
+}
+
+// moves the unparsed bytes to the beginning of the window and appends the next block
+static unsigned char * Gia_AigerStreamRefill( Gia_AigerStream_t * p, unsigned char * pCur )
+{
+    int nLeft = p->pEnd - pCur;
+    assert( nLeft >= 0 && nLeft <= GIA_STREAM_PAD );
+    memmove( p->pWindow, pCur, (size_t)nLeft );
+    p->pEnd = p->pWindow + nLeft;
+    p->pEnd += Gia_AigerStreamBlock( p, p->pEnd );
+    memset( p->pEnd, 0, GIA_STREAM_PAD );
+    p->pLimit = p->fEof ? p->pEnd + GIA_STREAM_PAD : p->pEnd - GIA_STREAM_PAD;
+    return p->pWindow;
+}
+static inline unsigned char * Gia_AigerStreamCheck( Gia_AigerStream_t * p, unsigned char * pCur )
+{
+    return (p && pCur > p->pLimit) ? Gia_AigerStreamRefill( p, pCur ) : pCur;
+}
+
+// appends the bytes up to and including the next newline to vData
+static int Gia_AigerStreamReadLine( Gia_AigerStream_t * p )
+{
+    unsigned char * pCur = p->pCur;
+    while ( 1 )
+    {
+        if ( pCur == p->pEnd && (pCur = Gia_AigerStreamRefill(p, pCur)) == p->pEnd )
+            return 0;
+        Vec_StrPush( p->vData, (char)*pCur );
+        if ( *pCur++ == '\n' )
+            break;
+    }
+    p->pCur = pCur;
+    return 1;
+}
+
+// appends the remaining bytes of the file to vData
+static void Gia_AigerStreamReadRest( Gia_AigerStream_t * p )
+{
+    do {
+        Vec_StrPushBuffer( p->vData, (char *)p->pCur, p->pEnd - p->pCur );
+        p->pCur = p->pEnd;
+    } while ( !p->fEof && Gia_AigerStreamRefill(p, p->pCur) < p->pEnd );
+}
+
+static void Gia_AigerStreamStop( Gia_AigerStream_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->fThread )
+    {
+        // let the thread finish the block it is filling
+        while ( !p->fEof )
+            Gia_AigerStreamRefill( p, p->pEnd );
+        pthread_join( p->Thread, NULL );
+        pthread_mutex_destroy( &p->Mutex );
+        pthread_cond_destroy( &p->Cond );
+    }
+#endif
+    gzclose( p->pFile );
+    Vec_StrFreeP( &p->vData );
+    ABC_FREE( p->pWindow );
+    ABC_FREE( p->pBlocks[0] );
+    ABC_FREE( p->pBlocks[1] );
+    ABC_FREE( p );
+}
+
+// opens the file and reads the text before the AND gates
+static Gia_AigerStream_t * Gia_AigerStreamStart( char * pFileName )
+{
+    Gia_AigerStream_t * p;
+    int Nums[9] = {0}, nLines, i;
+    gzFile pFile = gzopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    p = ABC_CALLOC( Gia_AigerStream_t, 1 );
+    p->pFile   = pFile;
+    p->vData   = Vec_StrAlloc( 1000 );
+    p->pWindow = ABC_ALLOC( unsigned char, GIA_STREAM_BLOCK + 2 * GIA_STREAM_PAD );
+    p->pCur    = p->pEnd = p->pLimit = p->pWindow;
+#ifdef ABC_USE_PTHREADS
+    p->pBlocks[0] = ABC_ALLOC( unsigned char, GIA_STREAM_BLOCK );
+    p->pBlocks[1] = ABC_ALLOC( unsigned char, GIA_STREAM_BLOCK );
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    p->fThread = !pthread_create( &p->Thread, NULL, Gia_AigerStreamThread, (void *)p );
+    if ( !p->fThread )
+    {
+        pthread_mutex_destroy( &p->Mutex );
+        pthread_cond_destroy( &p->Cond );
+    }
+#endif
+    // read the header (M I L O A + B C J F)
+    if ( !Gia_AigerStreamReadLine(p) )
+    {
+        Gia_AigerStreamStop( p );
+        return NULL;
+    }
+    Vec_StrPush( p->vData, '\0' );
+    sscanf( Vec_StrArray(p->vData), "aig %d %d %d %d %d %d %d %d %d", 
+        Nums, Nums+1, Nums+2, Nums+3, Nums+4, Nums+5, Nums+6, Nums+7, Nums+8 );
+    Vec_StrPop( p->vData );
+    // in the standard AIGER, read the driver lines of latches and outputs
+    if ( Vec_StrSize(p->vData) > 3 && Vec_StrEntry(p->vData, 3) == ' ' )
+    {
+        for ( nLines = 0, i = 2; i < 9; i++ )
+            nLines += i == 4 ? 0 : Nums[i];
+        for ( i = 0; i < nLines; i++ )
+            if ( !Gia_AigerStreamReadLine(p) )
+                break;
+    }
+    else // otherwise, the AND gates are not streamed
+        Gia_AigerStreamReadRest( p );
+    p->nPrefix = Vec_StrSize( p->vData );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AND gates.]
+
+  Description [When structural hashing is used, the AND gates are first
+  appended as they are, so that the literals of the file are the literals 
+  of the AIG, and the structural hashing is checked in bulk. This works 
+  for the files written from a strashed AIG. If the file contains a trivial 
+  AND gate (constant fanin or two fanins with the same variable) or two 
+  structurally equal AND gates, the appended gates are strashed in place 
+  and the remaining gates are strashed as they are read. The bytes come 
+  from the memory or, if pStream is given, from the decompressed blocks.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_AigerReadAnds( Gia_Man_t * p, Vec_Int_t * vNodes, unsigned char ** ppCur, Gia_AigerStream_t * pStream, int nAnds, int fGiaSimple, int fSkipStrash )
+{
+    unsigned char * pCur = pStream ? pStream->pCur : *ppCur;
+    unsigned uLit0 = 0, uLit1 = 0, uLit;
+    int i = 0, k, iNode0, iNode1, nObjs = Gia_ManObjNum(p);
+    if ( !fGiaSimple && !fSkipStrash )
+    {
+        assert( !p->fGiaSimple && p->nHTable == 0 );
+        for ( uLit = (unsigned)nObjs << 1; i < nAnds; i++, uLit += 2 )
+        {
+            pCur  = Gia_AigerStreamCheck( pStream, pCur );
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            if ( uLit1 >= uLit || uLit0 > uLit1 || uLit0 < 2 || (uLit0 >> 1) == (uLit1 >> 1) )
+                break;
+            Gia_ManAppendAnd( p, uLit0, uLit1 );
+        }
+        if ( i == nAnds && Gia_ManHashStartUnique(p) )
+        {
+            Gia_ManHashStop( p );
+            for ( i = 0; i < nAnds; i++ )
+                Vec_IntPush( vNodes, Abc_Var2Lit(nObjs + i, 0) );
+            if ( pStream )
+                pStream->pCur = pCur;
+            else
+                *ppCur = pCur;
+            return;
+        }
+        // strash the appended gates in place: each gate is read before 
+        // the strashed gates can reach its place
+        Gia_ManHashAlloc( p );
+        p->nObjs = nObjs;
+        for ( k = 0; k < i; k++ )
+        {
+            Gia_Obj_t * pObj = p->pObjs + nObjs + k;
+            unsigned uLitA = Gia_ObjFaninLit0(pObj, nObjs + k);
+            unsigned uLitB = Gia_ObjFaninLit1(pObj, nObjs + k);
+            memset( pObj, 0, sizeof(Gia_Obj_t) );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLitA >> 1), uLitA & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLitB >> 1), uLitB & 1 );
+            Vec_IntPush( vNodes, Gia_ManHashAnd(p, iNode0, iNode1) );
+        }
+        // the literals of the gate that stopped the first loop are already read
+        if ( i < nAnds )
+        {
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+            Vec_IntPush( vNodes, Gia_ManHashAnd(p, iNode0, iNode1) );
+            i++;
+        }
+    }
+    for ( ; i < nAnds; i++ )
+    {
+        uLit  = ((i + nObjs) << 1);
+        pCur  = Gia_AigerStreamCheck( pStream, pCur );
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+//        assert( uLit1 > uLit0 );
+        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+        assert( Vec_IntSize(vNodes) == i + nObjs );
+        if ( !fGiaSimple && fSkipStrash )
+        {
+            if ( iNode0 == iNode1 )
+                Vec_IntPush( vNodes, Gia_ManAppendBuf(p, iNode0) );
+            else
+                Vec_IntPush( vNodes, Gia_ManAppendAnd(p, iNode0, iNode1) );
+        }
+        else
+            Vec_IntPush( vNodes, Gia_ManHashAnd(p, iNode0, iNode1) );
+    }
+    if ( !fGiaSimple && !fSkipStrash )
+        Gia_ManHashStop( p );
+    if ( pStream )
+        pStream->pCur = pCur;
+    else
+        *ppCur = pCur;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If pStream is given, pContents holds the text before the 
+  AND gates, which are read from the stream, followed by the rest of 
+  the file.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, int nFileSize, Gia_AigerStream_t * pStream, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
+    int iObj, iNode0, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
     unsigned char * pDrivers, * pSymbols, * pCur;
-    unsigned uLit0, uLit1, uLit;
+    unsigned uLit0;
 
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
@@ -284,29 +648,17 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    Gia_AigerReadAnds( pNew, vNodes, &pCur, pStream, nAnds, fGiaSimple, fSkipStrash );
+    if ( pStream ) 
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
-        {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
-            else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
-        }
-        else
-            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        // the rest of the file follows the text before the AND gates
+        int iDrivers = pDrivers - (unsigned char *)pContents;
+        Gia_AigerStreamReadRest( pStream );
+        pContents = Vec_StrArray( pStream->vData );
+        nFileSize = Vec_StrSize( pStream->vData );
+        pDrivers  = (unsigned char *)pContents + iDrivers;
+        pCur      = (unsigned char *)pContents + pStream->nPrefix;
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -444,7 +796,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 }
                 else if ( *pType == 'n' )
                 {
-                    if ( Vec_IntSize(&pNew->vHTable) != 0 )
+                    if ( pNew->nHTable != 0 )
                     {
                         printf( "Structural hashing should be disabled to read internal nodes names.\n" );
                         fError = 1;
@@ -1002,6 +1354,40 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( vNamesRegOut ) Vec_PtrFreeFree( vNamesRegOut );
     return pNew;
 }
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, NULL, fGiaSimple, fSkipStrash, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the compressed AIGER file.]
+
+  Description [The AND gates of the standard binary AIGER are parsed 
+  while the file is decompressed, without storing the decompressed 
+  file in memory.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_AigerReadGz( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    Gia_Man_t * pNew;
+    Gia_AigerStream_t * pStream = Gia_AigerStreamStart( pFileName );
+    if ( pStream == NULL )
+    {
+        printf( "Gia_AigerReadGz(): Cannot read the header of the compressed file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( Vec_StrEntry(pStream->vData, 3) == ' ' ) // the AND gates are streamed
+        pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(pStream->vData), pStream->nPrefix, pStream, fGiaSimple, fSkipStrash, fCheck );
+    else
+        pNew = Gia_AigerReadFromMemoryInt( Vec_StrArray(pStream->vData), Vec_StrSize(pStream->vData), NULL, fGiaSimple, fSkipStrash, fCheck );
+    Gia_AigerStreamStop( pStream );
+    return pNew;
+}
 
 /**Function*************************************************************
 
@@ -1022,16 +1408,26 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     int nFileSize;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
     nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    if ( nFileSize > 0 && strlen(pFileName) > 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz") )
+        pNew = Gia_AigerReadGz( pFileName, fGiaSimple, fSkipStrash, fCheck );
+    else if ( nFileSize > 0 && (pContents = Gia_FileMap( pFileName, (size_t)nFileSize )) )
+    {
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        Gia_FileUnmap( pContents, (size_t)nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
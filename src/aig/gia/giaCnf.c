@@ -0,0 +1,559 @@
+/**CFile****************************************************************
+
+  FileName    [giaCnf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Fast CNF generation without conversion into AIG.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "sat/cnf/cnf.h"
+#include "bool/kit/kit.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// this is a port of the fast CNF generator (sat/cnf/cnfFast.c) to GIA;
+// the nodes are marked (MUX/XOR, multi-fanout, complemented fanout) as
+// roots, so that the cone of each root is a multi-input AND or a function
+// of at most six inputs, whose ISOPs give the clauses; the first pass
+// records the covers of all roots, the second pass writes the clauses
+// into the buffer of the exact size
+
+typedef struct Gia_CnfMan_t_ Gia_CnfMan_t;
+struct Gia_CnfMan_t_
+{
+    Gia_Man_t *      pGia;           // user's AIG
+    Vec_Int_t *      vRefs;          // fanout counters
+    Vec_Str_t *      vRoots;         // marks of the nodes having SAT variables
+    Vec_Wrd_t *      vSims;          // truth tables of the cone nodes
+    Vec_Int_t *      vLeaves;        // leaves of the cone
+    Vec_Int_t *      vNodes;         // internal nodes of the cone
+    Vec_Int_t *      vCover;         // ISOP
+    Vec_Int_t *      vRecs;          // per-root records of the clauses
+    Vec_Int_t *      vRecRoots;      // roots in the order of records
+    int              nClauses;       // the number of clauses
+    int              nLiterals;      // the number of literals
+};
+
+// record types
+#define GIA_CNF_AND   0              // multi-input AND: leaves
+#define GIA_CNF_CONST 1              // constant function: polarity
+#define GIA_CNF_SOP   2              // function: leaves, onset and offset ISOPs
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the leaves of the multi-input gate.]
+
+  Description [If fStopCompl is set, collects complemented literals
+  and stops at complemented edges; otherwise, collects node IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CnfCollectLeaves_rec( Gia_CnfMan_t * p, int iRoot, int iLit, Vec_Int_t * vSuper, int fStopCompl )
+{
+    int iObj = Abc_Lit2Var(iLit);
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    if ( iObj != iRoot && (Vec_StrEntry(p->vRoots, iObj) || (fStopCompl && Abc_LitIsCompl(iLit))) )
+    {
+        Vec_IntPushUnique( vSuper, fStopCompl ? iLit : iObj );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( fStopCompl )
+    {
+        Gia_CnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit0(pObj, iObj), vSuper, 1 );
+        Gia_CnfCollectLeaves_rec( p, iRoot, Gia_ObjFaninLit1(pObj, iObj), vSuper, 1 );
+    }
+    else
+    {
+        Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId0(pObj, iObj), 0), vSuper, 0 );
+        Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(Gia_ObjFaninId1(pObj, iObj), 0), vSuper, 0 );
+    }
+}
+static void Gia_CnfCollectLeaves( Gia_CnfMan_t * p, int iRoot, Vec_Int_t * vSuper, int fStopCompl )
+{
+    Vec_IntClear( vSuper );
+    Gia_CnfCollectLeaves_rec( p, iRoot, Abc_Var2Lit(iRoot, 0), vSuper, fStopCompl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes of the cone.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CnfCollectVolume_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjUpdateTravIdCurrentId(p, iObj) )
+        return;
+    pObj = Gia_ManObj( p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_CnfCollectVolume_rec( p, Gia_ObjFaninId0(pObj, iObj), vNodes );
+    Gia_CnfCollectVolume_rec( p, Gia_ObjFaninId1(pObj, iObj), vNodes );
+    Vec_IntPush( vNodes, iObj );
+}
+static void Gia_CnfCollectVolume( Gia_Man_t * p, int iRoot, Vec_Int_t * vLeaves, Vec_Int_t * vNodes )
+{
+    int i, iObj;
+    Gia_ManIncrementTravId( p );
+    Vec_IntForEachEntry( vLeaves, iObj, i )
+        Gia_ObjSetTravIdCurrentId( p, iObj );
+    Vec_IntClear( vNodes );
+    Gia_CnfCollectVolume_rec( p, iRoot, vNodes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the cone.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Gia_CnfCutTruth( Gia_CnfMan_t * p, Vec_Int_t * vLeaves, Vec_Int_t * vNodes )
+{
+    Gia_Obj_t * pObj;
+    word * pSims = Vec_WrdArray( p->vSims ), Sim0, Sim1;
+    int i, iObj = -1;
+    assert( Vec_IntSize(vLeaves) <= 6 && Vec_IntSize(vNodes) > 0 );
+    Vec_IntForEachEntry( vLeaves, iObj, i )
+        pSims[iObj] = s_Truths6[i];
+    Vec_IntForEachEntry( vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p->pGia, iObj );
+        Sim0 = pSims[Gia_ObjFaninId0(pObj, iObj)];
+        Sim1 = pSims[Gia_ObjFaninId1(pObj, iObj)];
+        pSims[iObj] = (Gia_ObjFaninC0(pObj) ? ~Sim0 : Sim0) & (Gia_ObjFaninC1(pObj) ? ~Sim1 : Sim1);
+    }
+    return pSims[iObj];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the nodes that will have SAT variables.]
+
+  Description [The marking is the same as in Cnf_DeriveFastMark().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CnfMarkRoots( Gia_CnfMan_t * p )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Str_t * vMuxes = Vec_StrStart( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vSupps = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Gia_Obj_t * pObj, * pObj0, * pObj1;
+    int i, k, Id0, Id1, iLit, nFans;
+    // count fanouts
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0(pObj, i), 1 );
+        Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId1(pObj, i), 1 );
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0p(pGia, pObj), 1 );
+    // mark the constant, the CIs and the CO drivers
+    Vec_StrWriteEntry( p->vRoots, 0, 1 );
+    Gia_ManForEachCi( pGia, pObj, i )
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjId(pGia, pObj), 1 );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId0p(pGia, pObj), 1 );
+    // mark MUX/XOR nodes whose AND-nodes are not shared
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( !Gia_ObjIsMuxType(pObj) )
+            continue;
+        Id0 = Gia_ObjFaninId0(pObj, i);
+        Id1 = Gia_ObjFaninId1(pObj, i);
+        if ( Vec_StrEntry(vMuxes, Id0) || Vec_IntEntry(p->vRefs, Id0) > 1 )
+            continue;
+        if ( Vec_StrEntry(vMuxes, Id1) || Vec_IntEntry(p->vRefs, Id1) > 1 )
+            continue;
+        Vec_StrWriteEntry( vMuxes, i, 1 );
+        Vec_StrWriteEntry( vMuxes, Id0, 1 );
+        Vec_StrWriteEntry( vMuxes, Id1, 1 );
+        pObj0 = Gia_ObjFanin0(pObj);
+        pObj1 = Gia_ObjFanin1(pObj);
+        Vec_StrWriteEntry( p->vRoots, i, 1 );
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId0(pObj0, Id0), 1 );
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId1(pObj0, Id0), 1 );
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId0(pObj1, Id1), 1 );
+        Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId1(pObj1, Id1), 1 );
+    }
+    // mark nodes with multiple fanouts and nodes pointed to by complemented edges
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( Vec_IntEntry(p->vRefs, i) > 1 )
+            Vec_StrWriteEntry( p->vRoots, i, 1 );
+        if ( Gia_ObjFaninC0(pObj) && !Vec_StrEntry(vMuxes, Gia_ObjFaninId0(pObj, i)) )
+            Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId0(pObj, i), 1 );
+        if ( Gia_ObjFaninC1(pObj) && !Vec_StrEntry(vMuxes, Gia_ObjFaninId1(pObj, i)) )
+            Vec_StrWriteEntry( p->vRoots, Gia_ObjFaninId1(pObj, i), 1 );
+    }
+    // absorb small fanin cones into their fanouts
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        if ( !Vec_StrEntry(p->vRoots, i) )
+            continue;
+        if ( Vec_StrEntry(vMuxes, i) )
+        {
+            if ( !Gia_ObjIsMuxType(pObj) )
+                continue;
+            Gia_ObjRecognizeMux( pObj, &pObj1, &pObj0 );
+            Id0 = Gia_ObjId( pGia, Gia_Regular(pObj0) );
+            Id1 = Gia_ObjId( pGia, Gia_Regular(pObj1) );
+            assert( Vec_StrEntry(p->vRoots, Id0) && Vec_StrEntry(p->vRoots, Id1) );
+            nFans = 1 + (Id0 == Id1);
+            if ( !Vec_StrEntry(vMuxes, Id0) && Gia_ObjIsAnd(Gia_Regular(pObj0)) && Vec_IntEntry(p->vRefs, Id0) == nFans && Vec_IntEntry(vSupps, Id0) < 3 )
+            {
+                Vec_StrWriteEntry( p->vRoots, Id0, 0 );
+                continue;
+            }
+            if ( !Vec_StrEntry(vMuxes, Id1) && Gia_ObjIsAnd(Gia_Regular(pObj1)) && Vec_IntEntry(p->vRefs, Id1) == nFans && Vec_IntEntry(vSupps, Id1) < 3 )
+            {
+                Vec_StrWriteEntry( p->vRoots, Id1, 0 );
+                continue;
+            }
+            continue;
+        }
+        Gia_CnfCollectLeaves( p, i, p->vLeaves, 1 );
+        Vec_IntWriteEntry( vSupps, i, Vec_IntSize(p->vLeaves) );
+        if ( Vec_IntSize(p->vLeaves) >= 6 )
+            continue;
+        Vec_IntForEachEntry( p->vLeaves, iLit, k )
+        {
+            int iLeaf = Abc_Lit2Var(iLit);
+            assert( Vec_StrEntry(p->vRoots, iLeaf) );
+            if ( Vec_StrEntry(vMuxes, iLeaf) || !Gia_ObjIsAnd(Gia_ManObj(pGia, iLeaf)) || Vec_IntEntry(p->vRefs, iLeaf) > 1 )
+                continue;
+            assert( Vec_IntEntry(vSupps, iLeaf) > 0 );
+            if ( Vec_IntSize(p->vLeaves) - 1 + Vec_IntEntry(vSupps, iLeaf) > 6 )
+                continue;
+            Vec_StrWriteEntry( p->vRoots, iLeaf, 0 );
+            Vec_IntWriteEntry( vSupps, i, 6 );
+            break;
+        }
+    }
+    Vec_StrFree( vMuxes );
+    Vec_IntFree( vSupps );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the clauses of one root.]
+
+  Description [Updates the number of clauses and literals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_CnfRecordRoot( Gia_CnfMan_t * p, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int i, c, k, iObj, Cube, RetValue, iSize;
+    word Truth, Truths[2];
+    Vec_IntPush( p->vRecRoots, iRoot );
+    Vec_IntPush( p->vRecRoots, Vec_IntSize(p->vRecs) );
+    Gia_CnfCollectLeaves( p, iRoot, p->vLeaves, 0 );
+    Gia_CnfCollectVolume( p->pGia, iRoot, p->vLeaves, p->vNodes );
+    assert( iRoot == Vec_IntEntryLast(p->vNodes) );
+    // check if this is an AND-gate
+    Vec_IntForEachEntry( p->vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p->pGia, iObj );
+        if ( Gia_ObjFaninC0(pObj) && !Vec_StrEntry(p->vRoots, Gia_ObjFaninId0(pObj, iObj)) )
+            break;
+        if ( Gia_ObjFaninC1(pObj) && !Vec_StrEntry(p->vRoots, Gia_ObjFaninId1(pObj, iObj)) )
+            break;
+    }
+    if ( i == Vec_IntSize(p->vNodes) )
+    {
+        Gia_CnfCollectLeaves( p, iRoot, p->vLeaves, 1 );
+        Vec_IntPush( p->vRecs, GIA_CNF_AND );
+        Vec_IntPush( p->vRecs, Vec_IntSize(p->vLeaves) );
+        Vec_IntAppend( p->vRecs, p->vLeaves );
+        p->nClauses  += 1 + Vec_IntSize(p->vLeaves);
+        p->nLiterals += 1 + 3 * Vec_IntSize(p->vLeaves);
+        return;
+    }
+    assert( Vec_IntSize(p->vLeaves) <= 6 );
+    Truth = Gia_CnfCutTruth( p, p->vLeaves, p->vNodes );
+    if ( Truth == 0 || Truth == ~(word)0 )
+    {
+        Vec_IntPush( p->vRecs, GIA_CNF_CONST );
+        Vec_IntPush( p->vRecs, Truth == 0 );
+        p->nClauses++;
+        p->nLiterals++;
+        return;
+    }
+    Vec_IntPush( p->vRecs, GIA_CNF_SOP );
+    Vec_IntPush( p->vRecs, Vec_IntSize(p->vLeaves) );
+    Vec_IntForEachEntry( p->vLeaves, iObj, i )
+        Vec_IntPush( p->vRecs, Abc_Var2Lit(iObj, 0) );
+    Truths[0] = ~Truth;
+    Truths[1] =  Truth;
+    for ( c = 1; c >= 0; c-- )
+    {
+        RetValue = Kit_TruthIsop( (unsigned *)&Truths[c], Vec_IntSize(p->vLeaves), p->vCover, 0 );
+        assert( RetValue >= 0 );
+        Vec_IntPush( p->vRecs, Vec_IntSize(p->vCover) );
+        Vec_IntForEachEntry( p->vCover, Cube, i )
+        {
+            Vec_IntPush( p->vRecs, Cube );
+            for ( iSize = 1, k = 0; k < Vec_IntSize(p->vLeaves); k++, Cube >>= 2 )
+                iSize += ((Cube & 3) != 0);
+            p->nLiterals += iSize;
+        }
+        p->nClauses += Vec_IntSize(p->vCover);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of one root.]
+
+  Description [Returns the number of clauses written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_CnfWriteRoot( int * pRec, int * pMap, int OutLit, int *** pppClas, int ** ppLits )
+{
+    int ** pClas = *pppClas, * pLits = *ppLits;
+    int i, k, c, nLeaves, nCubes, Cube, * pLeaves;
+    int Type = *pRec++, nClauses = 0;
+    if ( Type == GIA_CNF_CONST )
+    {
+        *pClas++ = pLits;
+        *pLits++ = Abc_LitNotCond( OutLit, *pRec );
+        nClauses = 1;
+    }
+    else if ( Type == GIA_CNF_AND )
+    {
+        nLeaves = *pRec++;
+        pLeaves = pRec;
+        // write big clause
+        *pClas++ = pLits;
+        *pLits++ = OutLit;
+        for ( k = 0; k < nLeaves; k++ )
+            *pLits++ = Abc_Var2Lit( pMap[Abc_Lit2Var(pLeaves[k])], !Abc_LitIsCompl(pLeaves[k]) );
+        // write small clauses
+        for ( k = 0; k < nLeaves; k++ )
+        {
+            *pClas++ = pLits;
+            *pLits++ = Abc_LitNot( OutLit );
+            *pLits++ = Abc_Var2Lit( pMap[Abc_Lit2Var(pLeaves[k])], Abc_LitIsCompl(pLeaves[k]) );
+        }
+        nClauses = 1 + nLeaves;
+    }
+    else if ( Type == GIA_CNF_SOP )
+    {
+        nLeaves = *pRec++;
+        pLeaves = pRec;
+        pRec   += nLeaves;
+        for ( c = 1; c >= 0; c-- )
+        {
+            nCubes = *pRec++;
+            for ( i = 0; i < nCubes; i++ )
+            {
+                *pClas++ = pLits;
+                *pLits++ = Abc_LitNotCond( OutLit, !c );
+                for ( Cube = *pRec++, k = 0; k < nLeaves; k++, Cube >>= 2 )
+                {
+                    if ( (Cube & 3) == 0 )
+                        continue;
+                    assert( (Cube & 3) != 3 );
+                    *pLits++ = Abc_Var2Lit( pMap[Abc_Lit2Var(pLeaves[k])], (Cube & 3) != 1 );
+                }
+            }
+            nClauses += nCubes;
+        }
+    }
+    else assert( 0 );
+    *pppClas = pClas;
+    *ppLits  = pLits;
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the AIG without mapping.]
+
+  Description [The CNF is similar to that of Mf_ManGenerateCnf(): there is
+  a SAT variable for each CO (equivalent to its driver), for each CI, for
+  the constant node, and for each root node. If fCnfObjIds is set, the
+  object IDs are used as SAT variables. If fAddOrCla is set, the clause
+  asserting that one of the COs is 1 is added. The mapping of objects
+  into their clauses (pObj2Clause/pObj2Count) is created, which allows
+  for loading the clauses into the solver one cone at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_ManCnfDeriveFast( Gia_Man_t * pGia, int fCnfObjIds, int fAddOrCla, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_CnfMan_t * p;
+    Cnf_Dat_t * pCnf;
+    Gia_Obj_t * pObj;
+    int i, Id, DriId, iRec, nVars = 1, ** pClas, * pLits, * pMap;
+    // mark the roots
+    p = ABC_CALLOC( Gia_CnfMan_t, 1 );
+    p->pGia      = pGia;
+    p->vRefs     = Vec_IntStart( Gia_ManObjNum(pGia) );
+    p->vRoots    = Vec_StrStart( Gia_ManObjNum(pGia) );
+    p->vSims     = Vec_WrdStart( Gia_ManObjNum(pGia) );
+    p->vLeaves   = Vec_IntAlloc( 100 );
+    p->vNodes    = Vec_IntAlloc( 100 );
+    p->vCover    = Vec_IntAlloc( 1 << 8 );
+    p->vRecs     = Vec_IntAlloc( 4 * Gia_ManObjNum(pGia) );
+    p->vRecRoots = Vec_IntAlloc( 2 * Gia_ManAndNum(pGia) );
+    Gia_CnfMarkRoots( p );
+    // record the clauses of the roots
+    Gia_ManForEachAndReverseId( pGia, Id )
+        if ( Vec_StrEntry(p->vRoots, Id) )
+            Gia_CnfRecordRoot( p, Id );
+    // the clauses of the COs and the constant node
+    p->nClauses  += 2 * Gia_ManCoNum(pGia) + 1 + fAddOrCla;
+    p->nLiterals += 4 * Gia_ManCoNum(pGia) + 1 + fAddOrCla * Gia_ManCoNum(pGia);
+    // assign SAT variables
+    pMap = ABC_FALLOC( int, Gia_ManObjNum(pGia) );
+    if ( fCnfObjIds )
+    {
+        nVars = Gia_ManObjNum(pGia);
+        Gia_ManForEachCoId( pGia, Id, i )
+            pMap[Id] = Id;
+        Gia_ManForEachAndReverseId( pGia, Id )
+            if ( Vec_StrEntry(p->vRoots, Id) )
+                pMap[Id] = Id;
+        pMap[0] = 0;
+        Gia_ManForEachCiId( pGia, Id, i )
+            pMap[Id] = Id;
+    }
+    else
+    {
+        Gia_ManForEachCoId( pGia, Id, i )
+            pMap[Id] = nVars++;
+        Gia_ManForEachAndReverseId( pGia, Id )
+            if ( Vec_StrEntry(p->vRoots, Id) )
+                pMap[Id] = nVars++;
+        pMap[0] = nVars++;
+        Gia_ManForEachCiId( pGia, Id, i )
+            pMap[Id] = nVars++;
+    }
+    // allocate the CNF
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pMan        = (Aig_Man_t *)pGia;
+    pCnf->nVars       = nVars;
+    pCnf->nLiterals   = p->nLiterals;
+    pCnf->nClauses    = p->nClauses;
+    pCnf->pClauses    = ABC_ALLOC( int *, p->nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, p->nLiterals );
+    pCnf->pClauses[p->nClauses] = pCnf->pClauses[0] + p->nLiterals;
+    pCnf->pVarNums    = pMap;
+    pCnf->pObj2Clause = ABC_FALLOC( int, Gia_ManObjNum(pGia) );
+    pCnf->pObj2Count  = ABC_FALLOC( int, Gia_ManObjNum(pGia) );
+    Gia_ManForEachCiId( pGia, Id, i )
+        pCnf->pObj2Count[Id] = 0;
+    pClas = pCnf->pClauses;
+    pLits = pCnf->pClauses[0];
+    // add the output clause
+    if ( fAddOrCla )
+    {
+        *pClas++ = pLits;
+        Gia_ManForEachCoId( pGia, Id, i )
+            *pLits++ = Abc_Var2Lit( pMap[Id], 0 );
+    }
+    // add the clauses of the COs
+    Gia_ManForEachCo( pGia, pObj, i )
+    {
+        Id = Gia_ObjId( pGia, pObj );
+        DriId = Gia_ObjFaninId0( pObj, Id );
+        pCnf->pObj2Clause[Id] = pClas - pCnf->pClauses;
+        pCnf->pObj2Count[Id]  = 2;
+        *pClas++ = pLits;
+        *pLits++ = Abc_Var2Lit( pMap[Id], 0 );
+        *pLits++ = Abc_Var2Lit( pMap[DriId], !Gia_ObjFaninC0(pObj) );
+        *pClas++ = pLits;
+        *pLits++ = Abc_Var2Lit( pMap[Id], 1 );
+        *pLits++ = Abc_Var2Lit( pMap[DriId], Gia_ObjFaninC0(pObj) );
+    }
+    // add the clauses of the roots
+    Vec_IntForEachEntryDouble( p->vRecRoots, Id, iRec, i )
+    {
+        pCnf->pObj2Clause[Id] = pClas - pCnf->pClauses;
+        pCnf->pObj2Count[Id]  = Gia_CnfWriteRoot( Vec_IntEntryP(p->vRecs, iRec), pMap, Abc_Var2Lit(pMap[Id], 0), &pClas, &pLits );
+    }
+    // add the constant clause
+    pCnf->pObj2Clause[0] = pClas - pCnf->pClauses;
+    pCnf->pObj2Count[0]  = 1;
+    *pClas++ = pLits;
+    *pLits++ = Abc_Var2Lit( pMap[0], 1 );
+    assert( pClas - pCnf->pClauses == p->nClauses );
+    assert( pLits - pCnf->pClauses[0] == p->nLiterals );
+    if ( fVerbose )
+    {
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // cleanup
+    Vec_IntFree( p->vRefs );
+    Vec_StrFree( p->vRoots );
+    Vec_WrdFree( p->vSims );
+    Vec_IntFree( p->vLeaves );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vCover );
+    Vec_IntFree( p->vRecs );
+    Vec_IntFree( p->vRecRoots );
+    ABC_FREE( p );
+    return pCnf;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
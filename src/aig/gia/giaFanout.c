@@ -224,6 +224,200 @@ Vec_Int_t * Gia_ManStartFanoutMap( Gia_Man_t * p, Vec_Int_t * vFanoutNums )
     return vEdgeMap;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of edges reserved for the kept fanout.]
+
+  Description [The kept static fanout has the same layout as the regular 
+  one (the offsets are followed by the edges), except that each object has 
+  room for at least two fanouts, or the nearest power of two, so that new 
+  fanouts can be added without moving other objects' edges. An object that 
+  runs out of room is moved to the end of the array with twice the room.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManStaticFanoutCap( int nFans )
+{
+    return nFans == 0 ? 0 : (nFans <= 2 ? 2 : 1 << Abc_Base2Log(nFans));
+}
+static inline void Gia_ObjSetFanoutStatic( Gia_Man_t * p, int iObj, int iFan )
+{
+    int nFans = Vec_IntEntry( p->vFanoutNums, iObj );
+    Vec_IntWriteEntry( p->vFanout, Vec_IntEntry(p->vFanout, iObj) + nFans, iFan );
+    Vec_IntWriteEntry( p->vFanoutNums, iObj, nFans + 1 );
+}
+static inline void Gia_ObjAddFanoutStaticOne( Gia_Man_t * p, int iObj, int iFan )
+{
+    int k, nFans = Vec_IntEntry( p->vFanoutNums, iObj );
+    if ( nFans == Gia_ManStaticFanoutCap(nFans) )
+    {
+        int iOld = Vec_IntEntry( p->vFanout, iObj );
+        int iNew = Vec_IntSize( p->vFanout );
+        Vec_IntFillExtra( p->vFanout, iNew + Gia_ManStaticFanoutCap(nFans + 1), 0 );
+        for ( k = 0; k < nFans; k++ )
+            Vec_IntWriteEntry( p->vFanout, iNew + k, Vec_IntEntry(p->vFanout, iOld + k) );
+        Vec_IntWriteEntry( p->vFanout, iObj, iNew );
+    }
+    Gia_ObjSetFanoutStatic( p, iObj, iFan );
+}
+static void Gia_ManStaticFanoutGrowSlots( Gia_Man_t * p, int nSlotsNew )
+{
+    int i, nShift = nSlotsNew - p->nFanoutSlots, nEdges = Vec_IntSize(p->vFanout) - p->nFanoutSlots;
+    assert( nShift > 0 );
+    Vec_IntFillExtra( p->vFanout, Vec_IntSize(p->vFanout) + nShift, 0 );
+    memmove( Vec_IntArray(p->vFanout) + nSlotsNew, Vec_IntArray(p->vFanout) + p->nFanoutSlots, sizeof(int) * (size_t)nEdges );
+    for ( i = 0; i < p->nFanoutObjs; i++ )
+        Vec_IntAddToEntry( p->vFanout, i, nShift );
+    for ( ; i < nSlotsNew; i++ )
+        Vec_IntWriteEntry( p->vFanout, i, 0 );
+    p->nFanoutSlots = nSlotsNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the fanin edges of a new object to the kept fanout.]
+
+  Description [Called by the procedures appending objects to the manager. 
+  The kept fanout is updated only if it is valid for all objects before 
+  this one; otherwise, it is invalidated and rebuilt on the next request.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ObjAddFanoutStatic( Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    int iObj = Gia_ObjId( p, pObj );
+    assert( p->fFanoutKeep );
+    if ( p->nFanoutObjs != iObj )
+    {
+        Gia_ManStaticFanoutInvalidate( p );
+        return;
+    }
+    if ( iObj == p->nFanoutSlots )
+        Gia_ManStaticFanoutGrowSlots( p, 2 * p->nFanoutSlots );
+    Vec_IntWriteEntry( p->vFanout, iObj, Vec_IntSize(p->vFanout) );
+    Vec_IntPush( p->vFanoutNums, 0 );
+    p->nFanoutObjs++;
+    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+        Gia_ObjAddFanoutStaticOne( p, Gia_ObjFaninId0(pObj, iObj), iObj );
+    if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+        Gia_ObjAddFanoutStaticOne( p, Gia_ObjFaninId1(pObj, iObj), iObj );
+    if ( Gia_ObjIsMuxId(p, iObj) )
+        Gia_ObjAddFanoutStaticOne( p, Gia_ObjFaninId2(p, iObj), iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the kept static fanout for all objects.]
+
+  Description [Does nothing if the kept fanout is already valid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManStaticFanoutKeepBuild( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int * pRefsOld;
+    int i, iOffset;
+    assert( p->fFanoutKeep );
+    if ( p->nFanoutObjs == Gia_ManObjNum(p) )
+        return;
+    // free the invalid fanout or the fanout of another kind
+    Vec_IntFreeP( &p->vFanoutNums );
+    Vec_IntFreeP( &p->vFanout );
+    // recompute reference counters
+    pRefsOld = p->pRefs; p->pRefs = NULL;
+    Gia_ManCreateRefs(p);
+    p->vFanoutNums = Vec_IntAllocArray( p->pRefs, Gia_ManObjNum(p) );
+    p->pRefs = pRefsOld;
+    // reserve room for the fanouts and fill them in
+    p->nFanoutSlots = Abc_MaxInt( p->nObjsAlloc, 16 );
+    p->vFanout = Vec_IntStart( p->nFanoutSlots );
+    iOffset = p->nFanoutSlots;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        Vec_IntWriteEntry( p->vFanout, i, iOffset );
+        iOffset += Gia_ManStaticFanoutCap( Vec_IntEntry(p->vFanoutNums, i) );
+    }
+    Vec_IntFillExtra( p->vFanout, iOffset, 0 );
+    Vec_IntFill( p->vFanoutNums, Gia_ManObjNum(p), 0 );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+            Gia_ObjSetFanoutStatic( p, Gia_ObjFaninId0(pObj, i), i );
+        if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+            Gia_ObjSetFanoutStatic( p, Gia_ObjFaninId1(pObj, i), i );
+        if ( Gia_ObjIsMuxId(p, i) )
+            Gia_ObjSetFanoutStatic( p, Gia_ObjFaninId2(p, i), i );
+    }
+    assert( Vec_IntSize(p->vFanout) == iOffset );
+    p->nFanoutObjs = Gia_ManObjNum(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the manager keep its static fanout.]
+
+  Description [After this call, Gia_ManStaticFanoutStart() builds the 
+  static fanout only if it is not valid, Gia_ManStaticFanoutStop() leaves 
+  it in place, and the procedures appending objects update it, so that 
+  several passes can share it without rebuilding. The fanout of a new 
+  manager is maintained from the start; otherwise, it is built on the 
+  first request. A static fanout, which was started by a caller and is 
+  not owned by the manager, is freed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManStaticFanoutKeepStart( Gia_Man_t * p )
+{
+    if ( p->fFanoutKeep )
+        return;
+    Vec_IntFreeP( &p->vFanoutNums );
+    Vec_IntFreeP( &p->vFanout );
+    p->fFanoutKeep = 1;
+    p->nFanoutObjs = 0;
+    if ( Gia_ManObjNum(p) == 1 )
+        Gia_ManStaticFanoutKeepBuild( p );
+}
+void Gia_ManStaticFanoutKeepStop( Gia_Man_t * p )
+{
+    p->fFanoutKeep = 0;
+    p->nFanoutObjs = 0;
+    Gia_ManStaticFanoutStop( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Invalidates the kept static fanout.]
+
+  Description [Should be called when the objects are changed in place.
+  The fanout is rebuilt by the next call to Gia_ManStaticFanoutStart().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManStaticFanoutInvalidate( Gia_Man_t * p )
+{
+    if ( p->nFanoutObjs == 0 )
+        return;
+    p->nFanoutObjs = 0;
+    Vec_IntFreeP( &p->vFanoutNums );
+    Vec_IntFreeP( &p->vFanout );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Allocates static fanout.]
@@ -241,6 +435,11 @@ void Gia_ManStaticFanoutStart( Gia_Man_t * p )
     int * pRefsOld;
     Gia_Obj_t * pObj, * pFanin;
     int i, iFanout;
+    if ( p->fFanoutKeep )
+    {
+        Gia_ManStaticFanoutKeepBuild( p );
+        return;
+    }
     assert( p->vFanoutNums == NULL );
     assert( p->vFanout == NULL );
     // recompute reference counters
@@ -338,6 +537,8 @@ void Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex )
     int * pRefsOld;
     Gia_Obj_t * pObj, * pFanin;
     int i, k, iFan, iFanout, Index;
+    if ( p->fFanoutKeep )
+        Gia_ManStaticFanoutInvalidate( p );
     assert( p->vFanoutNums == NULL );
     assert( p->vFanout == NULL );
     // recompute reference counters
@@ -392,6 +593,8 @@ void Gia_ManStaticMappingFanoutStart( Gia_Man_t * p, Vec_Int_t ** pvIndex )
 ***********************************************************************/
 void Gia_ManStaticFanoutStop( Gia_Man_t * p )
 {
+    if ( p->fFanoutKeep && p->nFanoutObjs )
+        return;
     Vec_IntFreeP( &p->vFanoutNums );
     Vec_IntFreeP( &p->vFanout );
 }
@@ -27,6 +27,26 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// The hash table uses open addressing with linear probing. Each slot takes
+// three entries of p->pHTable: the node ID (0 if the slot is empty) followed
+// by the fanin literals of the node, so that probing compares the keys
+// without touching the objects. The table is resized when it is 3/4 full.
+// For MUX nodes, the control literal is compared using p->pMuxes.
+// The slots are counted in int and the entries are indexed in size_t, so the
+// table takes 12 bytes per slot, or 16 to 24 bytes per AND node.
+
+#define GIA_HASH_SLOT_MAX ABC_INT_MAX
+
+// the largest table is less than 3/4 full when the AIG has the most objects
+#if (1 << GIA_OBJ_LOG) >= GIA_HASH_SLOT_MAX / 4 * 3
+#error The hash table cannot hold the largest AIG
+#endif
+
+static inline int   Gia_ManHashSlotNum( Gia_Man_t * p )   { return p->nHTable;                                  }
+static inline int * Gia_ManHashSlot( Gia_Man_t * p, int i ) { return p->pHTable + (size_t)GIA_HASH_SLOT * i;    }
+static inline void  Gia_ManHashSlotSet( int * pPlace, int iLit0, int iLit1, int iObj ) { pPlace[0] = iObj; pPlace[1] = iLit0; pPlace[2] = iLit1; }
+static inline int   Gia_ManHashSlotNumFit( word nSlots )   { return (int)Abc_MinWord( Abc_MaxWord(nSlots, 1000), GIA_HASH_SLOT_MAX ); }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -35,7 +55,9 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The place is the slot of the table, whose first entry is
+  the node ID. The slot does not move when new nodes are added, as long as
+  the table is not resized.]
                
   SideEffects []
 
@@ -44,25 +66,28 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1;
+    Key ^= (unsigned)iLit1 * 0x85EBCA77;
+    Key ^= (unsigned)(iLitC + 1) * 0xC2B2AE3D;
+    Key ^= Key >> 15;
+    return (int)(((word)Key * (word)TableSize) >> 32);
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    int nSlots = Gia_ManHashSlotNum(p);
+    int i = Gia_ManHashOne( iLit0, iLit1, iLitC, nSlots );
+    int * pPlace = Gia_ManHashSlot( p, i );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    while ( pPlace[0] )
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
+        if ( pPlace[1] == iLit0 && pPlace[2] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, pPlace[0]) == iLitC) )
             break;
+        if ( ++i == nSlots )
+            i = 0, pPlace = Gia_ManHashSlot( p, 0 );
+        else
+            pPlace += GIA_HASH_SLOT;
     }
     return pPlace;
 }
@@ -104,11 +129,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
-    assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    word nNodes = Gia_ManAndNum(p) ? (word)Gia_ManAndNum(p) + 1000 : (word)p->nObjsAlloc;
+    assert( p->nHTable == 0 );
+    p->nHTable = Gia_ManHashSlotNumFit( nNodes + nNodes / 2 );
+    p->pHTable = ABC_CALLOC( int, (size_t)GIA_HASH_SLOT * p->nHTable );
+//printf( "Alloced table with %d entries.\n", Gia_ManHashSlotNum(p) );
 }
 
 /**Function*************************************************************
@@ -131,10 +156,41 @@ void Gia_ManHashStart( Gia_Man_t * p )
     {
         pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
         assert( *pPlace == 0 );
-        *pPlace = i;
+        Gia_ManHashSlotSet( pPlace, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), i );
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the hash table if the AND nodes are unique.]
+
+  Description [Returns 0 and leaves the hash table stopped if two AND 
+  nodes have the same fanins. Used to strash an AIG in bulk after it 
+  was created without hashing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashStartUnique( Gia_Man_t * p )  
+{
+    Gia_Obj_t * pObj;
+    int * pPlace, i;
+    Gia_ManHashAlloc( p );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
+        if ( *pPlace )
+        {
+            Gia_ManHashStop( p );
+            return 0;
+        }
+        Gia_ManHashSlotSet( pPlace, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), i );
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops the hash table.]
@@ -148,15 +204,16 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    ABC_FREE( p->pHTable );
+    p->nHTable = 0;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [The new table is twice as large as the number of nodes.
+  The keys are stored in the table, so the objects are not accessed.]
                
   SideEffects []
 
@@ -165,39 +222,48 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
+    int i, k, nSlots, Counter, Counter2, * pOld, * pPlace;
+    int * pTableOld = p->pHTable, nSlotsOld = p->nHTable;
+    assert( nSlotsOld > 0 );
     // replace the table
-    Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
+    p->nHTable = nSlots = Gia_ManHashSlotNumFit( 2 * (word)Gia_ManAndNum(p) );
+    p->pHTable = ABC_CALLOC( int, (size_t)GIA_HASH_SLOT * nSlots );
+    // rehash the entries from the old table (they are unique, so the first empty slot is taken)
     Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
+    for ( i = 0; i < nSlotsOld; i++ )
+    {
+        pOld = pTableOld + (size_t)GIA_HASH_SLOT * i;
+        if ( pOld[0] == 0 )
+            continue;
+        k = Gia_ManHashOne( pOld[1], pOld[2], Gia_ObjFaninLit2(p, pOld[0]), nSlots );
+        for ( pPlace = Gia_ManHashSlot(p, k); pPlace[0]; pPlace = Gia_ManHashSlot(p, k) )
+            if ( ++k == nSlots )
+                k = 0;
+        Gia_ManHashSlotSet( pPlace, pOld[1], pOld[2], pOld[0] );
+        Counter++;
+    }
     Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
     assert( Counter == Counter2 );
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", nSlotsOld, nSlots );
+    ABC_FREE( pTableOld );
+}
+static inline void Gia_ManHashCheckSize( Gia_Man_t * p )
+{
+    int nSlots = Gia_ManHashSlotNum(p);
+    if ( Gia_ManAndNum(p) >= nSlots - (nSlots >> 2) && nSlots < GIA_HASH_SLOT_MAX )
+        Gia_ManHashResize( p );
+    // the table of the largest size is not resized, but it should have an empty slot
+    if ( Gia_ManAndNum(p) >= Gia_ManHashSlotNum(p) - 1 )
+        printf( "Hard limit on the number of slots in the hash table (%d) is reached. Quitting...\n", Gia_ManHashSlotNum(p) ), exit(1);
 }
 
 /**Function********************************************************************
 
   Synopsis    [Profiles the hash table.]
 
-  Description []
+  Description [Prints the distribution of the distances of the nodes 
+  from their home slots.]
 
   SideEffects []
 
@@ -206,21 +272,25 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
+    int Counts[10] = {0};
+    int i, k, nSlots = Gia_ManHashSlotNum(p), nEntries = 0, * pPlace;
+    printf( "Table size = %d. Entries = %d. ", nSlots, Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    for ( i = 0; i < nSlots; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        pPlace = Gia_ManHashSlot( p, i );
+        if ( pPlace[0] == 0 )
+            continue;
+        k = i - Gia_ManHashOne( pPlace[1], pPlace[2], Gia_ObjFaninLit2(p, pPlace[0]), nSlots );
+        if ( k < 0 )
+            k += nSlots;
+        Counts[Abc_MinInt(k, 9)]++;
+        nEntries++;
     }
+    printf( "Entries in the table = %d. Distance from the home slot:\n", nEntries );
+    for ( i = 0; i < 10; i++ )
+        if ( Counts[i] )
+            printf( "%s%d = %d  ", i == 9 ? ">=" : "", i, Counts[i] );
     printf( "\n" );
 }
 
@@ -478,8 +548,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashCheckSize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -494,15 +563,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashSlotSet( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -541,6 +602,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    Gia_ManHashCheckSize( p );
     {
         int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
         if ( *pPlace )
@@ -549,15 +611,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashSlotSet( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -585,11 +639,10 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( p->fGiaSimple )
     {
-        assert( Vec_IntSize(&p->vHTable) == 0 );
+        assert( p->nHTable == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashCheckSize( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -606,15 +659,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashSlotSet( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) ) );
         return Abc_Var2Lit( *pPlace, 0 );
     }
 }
@@ -740,6 +785,7 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
 {
     Gia_Man_t * pNew, * pTemp;
     Gia_Obj_t * pObj;
+    Vec_Int_t * vMap;
     int i;
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
     pNew->pName = Abc_UtilStrsav( p->pName );
@@ -763,11 +809,77 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
     pNew->fAddStrash = 0;
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
 //    printf( "Top gate is %s\n", Gia_ObjFaninC0(Gia_ManCo(pNew, 0))? "OR" : "AND" );
-    pNew = Gia_ManCleanup( pTemp = pNew );
-    Gia_ManStop( pTemp );
+    // the new AIG has no other data, so it is usually cleaned up without another copy
+    vMap = Gia_ManCleanupInPlace( pNew );
+    if ( vMap == NULL )
+    {
+        pNew = Gia_ManCleanup( pTemp = pNew );
+        Gia_ManStop( pTemp );
+    }
+    Vec_IntFreeP( &vMap );
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG in place.]
+
+  Description [Produces the same AIG as Gia_ManRehash() without additional 
+  hashing, but reuses the object array: each object is rehashed into the 
+  next free place, which never follows the object itself, because an object 
+  gives rise to at most one new node. Only the map of old object IDs into 
+  new literals is allocated, in addition to the hash table. Returns 0 if 
+  the AIG has other data indexed by object IDs, which would become invalid.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManRehashInPlace( Gia_Man_t * p )
+{
+    Vec_Int_t * vMap;
+    Gia_Obj_t Obj;
+    int i, iLit0, nObjs = Gia_ManObjNum(p);
+    if ( p->fGiaSimple || p->fAddStrash || !Gia_ManCanCompactInPlace(p) )
+        return 0;
+    if ( p->fFanoutKeep )
+        Gia_ManStaticFanoutInvalidate( p );
+    vMap = Vec_IntAlloc( nObjs );
+    Vec_IntPush( vMap, 0 );
+    Vec_IntClear( p->vCis );
+    Vec_IntClear( p->vCos );
+    p->nObjs = 1;
+    p->nBufs = 0;
+    Gia_ManHashAlloc( p );
+    for ( i = 1; i < nObjs; i++ )
+    {
+        // the object is copied, because its place may be taken by the new node
+        Obj = p->pObjs[i];
+        memset( p->pObjs + p->nObjs, 0, sizeof(Gia_Obj_t) );
+        if ( Gia_ObjIsCi(&Obj) )
+        {
+            Vec_IntPush( vMap, Gia_ManAppendCi(p) );
+            continue;
+        }
+        iLit0 = Abc_LitNotCond( Vec_IntEntry(vMap, i - Obj.iDiff0), Obj.fCompl0 );
+        if ( Gia_ObjIsCo(&Obj) )
+            Vec_IntPush( vMap, Gia_ManAppendCo(p, iLit0) );
+        else
+            Vec_IntPush( vMap, Gia_ManHashAnd(p, iLit0, Abc_LitNotCond(Vec_IntEntry(vMap, i - Obj.iDiff1), Obj.fCompl1)) );
+        assert( Gia_ManObjNum(p) <= i + 1 );
+    }
+    Gia_ManHashStop( p );
+    Vec_IntFree( vMap );
+    // clean the released objects and remove the dangling nodes
+    if ( Gia_ManObjNum(p) < nObjs )
+        memset( p->pObjs + Gia_ManObjNum(p), 0, sizeof(Gia_Obj_t) * (size_t)(nObjs - Gia_ManObjNum(p)) );
+    vMap = Gia_ManCleanupInPlace( p );
+    assert( vMap != NULL );
+    Vec_IntFreeP( &vMap );
+    return 1;
+}
+
 
 /**Function*************************************************************
 
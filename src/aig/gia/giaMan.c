@@ -83,6 +83,7 @@ void Gia_ManStop( Gia_Man_t * p )
 {
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
+    p->fFanoutKeep = 0;
     Gia_ManStaticFanoutStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
@@ -153,8 +154,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    ABC_FREE( p->pHTable );
     Vec_IntErase( &p->vRefs );
     Vec_StrFreeP( &p->vStopsF );
     Vec_StrFreeP( &p->vStopsB );    
@@ -174,6 +174,8 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
+    if ( p->pSnapMap )
+        Gia_ManSnapUnmap( p );
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
@@ -197,7 +199,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
-    Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * GIA_HASH_SLOT * (double)p->nHTable;
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
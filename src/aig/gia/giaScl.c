@@ -87,6 +87,113 @@ Gia_Man_t * Gia_ManCleanup( Gia_Man_t * p )
     return Gia_ManDupMarked( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the AIG can be compacted in place.]
+
+  Description [The objects can be renumbered in place only if there is no
+  other data indexed by the object IDs, because this data is not remapped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCanCompactInPlace( Gia_Man_t * p )
+{
+    if ( p->pMuxes || p->fSweeper || p->fBuiltInSim || p->nHTable )
+        return 0;
+    if ( p->pRefs || p->pLutRefs || Vec_IntSize(&p->vRefs) || p->vLevels || p->pTravIds )
+        return 0;
+    if ( p->pReprsOld || p->pReprs || p->pNexts || p->pSibls || p->pIso )
+        return 0;
+    if ( p->pFanData || p->vFanouts2 )
+        return 0;
+    if ( (p->vFanoutNums || p->vFanout) && !(p->fFanoutKeep && p->nFanoutObjs) )
+        return 0;
+    if ( p->vMapping || p->vMapping2 || p->vCellMapping || p->vPacking || p->vLutConfigs )
+        return 0;
+    if ( p->vEdgeDelay || p->vEdgeDelayR || p->vEdge1 || p->vEdge2 )
+        return 0;
+    if ( Vec_IntSize(&p->vCopies) || Vec_IntSize(&p->vCopies2) || p->vVar2Obj || p->vTruths )
+        return 0;
+    if ( p->vGateClasses || p->vObjClasses || p->vWeights || p->vSwitching || p->pSwitching || p->pPlacement )
+        return 0;
+    if ( p->vNamesNode || p->vIdsOrig || p->vIdsEquiv || p->vTiming || p->vSims || p->vSimsT )
+        return 0;
+    if ( p->vDoms || p->vXors || p->vBarBufs || p->vPolars || p->vClassOld || p->vClassNew || p->vTimeStamps )
+        return 0;
+    if ( p->vTtNums || p->vSuppWords || Vec_IntSize(&p->vCopiesTwo) || Vec_IntSize(&p->vVarMap) || p->vStopsF || p->vStopsB )
+        return 0;
+    if ( p->vTTLut || p->vMFFCsInfo || p->vMFFCsLuts || p->vLutsRankings || p->pData2 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs combinational cleanup in place.]
+
+  Description [Removes the internal nodes unreachable from the COs by 
+  moving the remaining objects towards the beginning of the array, which 
+  preserves their order, so the result is the same as Gia_ManCleanup(). 
+  Returns the map of old object IDs into new object IDs (-1 for the 
+  removed nodes), or NULL if the AIG cannot be compacted in place.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManCleanupInPlace( Gia_Man_t * p )
+{
+    Vec_Int_t * vMap;
+    Gia_Obj_t * pObj, Obj;
+    int i, iNew = 1, nObjs = Gia_ManObjNum(p);
+    if ( !Gia_ManCanCompactInPlace(p) )
+        return NULL;
+    Gia_ManCombMarkUsed( p );
+    vMap = Vec_IntStartFull( nObjs );
+    Vec_IntWriteEntry( vMap, 0, 0 );
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( pObj->fMark0 )
+            continue;
+        // the object is copied, because the new place may be the same
+        Obj = *pObj;
+        Obj.fMark0 = Obj.fMark1 = Obj.fPhase = 0;
+        Obj.Value = 0;
+        if ( Gia_ObjIsAnd(&Obj) )
+        {
+            Obj.iDiff0 = iNew - Vec_IntEntry( vMap, i - pObj->iDiff0 );
+            Obj.iDiff1 = iNew - Vec_IntEntry( vMap, i - pObj->iDiff1 );
+        }
+        else if ( Gia_ObjIsCo(&Obj) )
+        {
+            Obj.iDiff0 = iNew - Vec_IntEntry( vMap, i - pObj->iDiff0 );
+            Vec_IntWriteEntry( p->vCos, Obj.iDiff1, iNew );
+        }
+        else 
+            Vec_IntWriteEntry( p->vCis, Obj.iDiff1, iNew );
+        Vec_IntWriteEntry( vMap, i, iNew );
+        *Gia_ManObj( p, iNew++ ) = Obj;
+    }
+    // clean the released objects, so that they can be reused
+    if ( iNew < nObjs )
+        memset( Gia_ManObj(p, iNew), 0, sizeof(Gia_Obj_t) * (size_t)(nObjs - iNew) );
+    p->nObjs = iNew;
+    // the kept static fanout remains valid only if no objects were removed
+    if ( iNew < nObjs && p->fFanoutKeep )
+        Gia_ManStaticFanoutInvalidate( p );
+    // release the memory unless the objects are in the mapped snapshot
+    if ( p->pSnapMap == NULL && iNew < p->nObjsAlloc )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, iNew );
+        p->nObjsAlloc = iNew;
+    }
+    return vMap;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Skip the first outputs during cleanup.]
@@ -24,6 +24,16 @@
 //#include <immintrin.h>
 #include "aig/miniaig/miniaig.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -122,37 +132,159 @@ static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     for ( w = 0; w < nWords; w++ )
         pSims[w]   = ~pSims[w];
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Pattern-parallel simulation engine.]
+
+  Description [Simulates the combinational AIG for the CI patterns in vSimsPi
+  and writes the result into vSims, which is resized but not reallocated when
+  it already has the right size, so that callers simulating repeatedly can
+  reuse the same buffer. If fOuts is 0, vSims receives the values of all
+  objects (nWords words per object); otherwise, it receives the values of
+  the COs only. Since every pattern word is independent, the word range is
+  split into contiguous slices processed by nProcs threads. When only the
+  outputs are needed, each slice is simulated in blocks of GIA_SIM_BLOCK
+  words (or fewer, if there are fewer pattern words) using a small 
+  per-thread buffer instead of the full object array.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_SIM_BLOCK    16     // words per block when only outputs are needed
+#define GIA_SIM_THR_MAX 128     // the largest number of threads
+
+typedef struct Gia_SimThData_t_ Gia_SimThData_t;
+struct Gia_SimThData_t_
+{
+    Gia_Man_t *    p;          // AIG manager
+    word *         pSimsPi;    // CI patterns
+    word *         pSims;      // object or CO values
+    word *         pBuffer;    // block buffer (output mode)
+    int            nBuffer;    // the number of words per object in the block buffer
+    int            nWords;     // total word count
+    int            wStart;     // first word of the slice
+    int            wStop;      // last word of the slice plus one
+    int            fOuts;      // computing only the outputs
+};
+
+static void Gia_ManSimPatSimBlock( Gia_Man_t * p, word * pSims, int nStride, int nBlock )
+{
+    word pComps[2] = { 0, ~(word)0 };
+    Gia_Obj_t * pObj; int i, w;
+    memset( pSims, 0, sizeof(word)*nBlock );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
+        word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
+        word * pSims0 = pSims + nStride*Gia_ObjFaninId0(pObj, i);
+        word * pSims1 = pSims + nStride*Gia_ObjFaninId1(pObj, i);
+        word * pSims2 = pSims + nStride*i;
+        if ( Gia_ObjIsXor(pObj) )
+            for ( w = 0; w < nBlock; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+        else
+            for ( w = 0; w < nBlock; w++ )
+                pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+    }
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        int Id = Gia_ObjId(p, pObj);
+        word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
+        word * pSims0 = pSims + nStride*Gia_ObjFaninId0(pObj, Id);
+        word * pSims2 = pSims + nStride*Id;
+        for ( w = 0; w < nBlock; w++ )
+            pSims2[w] = (pSims0[w] ^ Diff0);
+    }
+}
+static void Gia_ManSimPatSimRange( Gia_SimThData_t * pData )
+{
+    Gia_Man_t * p = pData->p;
+    int nWords = pData->nWords;
+    int i, Id, w, nBlock;
+    if ( !pData->fOuts )
+    {
+        nBlock = pData->wStop - pData->wStart;
+        Gia_ManForEachCiId( p, Id, i )
+            memcpy( pData->pSims + Id*nWords + pData->wStart, pData->pSimsPi + i*nWords + pData->wStart, sizeof(word)*nBlock );
+        Gia_ManSimPatSimBlock( p, pData->pSims + pData->wStart, nWords, nBlock );
+        return;
+    }
+    for ( w = pData->wStart; w < pData->wStop; w += pData->nBuffer )
+    {
+        nBlock = Abc_MinInt( pData->nBuffer, pData->wStop - w );
+        Gia_ManForEachCiId( p, Id, i )
+            memcpy( pData->pBuffer + Id*pData->nBuffer, pData->pSimsPi + i*nWords + w, sizeof(word)*nBlock );
+        Gia_ManSimPatSimBlock( p, pData->pBuffer, pData->nBuffer, nBlock );
+        Gia_ManForEachCoId( p, Id, i )
+            memcpy( pData->pSims + i*nWords + w, pData->pBuffer + Id*pData->nBuffer, sizeof(word)*nBlock );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+static void * Gia_ManSimPatSimThread( void * pArg )
+{
+    Gia_ManSimPatSimRange( (Gia_SimThData_t *)pArg );
+    return NULL;
+}
+#endif
+void Gia_ManSimPatSimMt( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, Vec_Wrd_t * vSims, int fOuts, int nProcs )
+{
+    Gia_SimThData_t ThData[GIA_SIM_THR_MAX];
+    int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(p);
+    int nSize = nWords * (fOuts ? Gia_ManCoNum(p) : Gia_ManObjNum(p));
+    int nBlocks = Abc_MaxInt( 1, (nWords + GIA_SIM_BLOCK - 1) / GIA_SIM_BLOCK );
+    int nBuffer = Abc_MaxInt( 1, Abc_MinInt( GIA_SIM_BLOCK, nWords ) );
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(p) == 0 );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    nProcs = Abc_MaxInt( 1, Abc_MinInt( Abc_MinInt(nProcs, GIA_SIM_THR_MAX), nBlocks ) );
+    if ( Vec_WrdSize(vSims) != nSize )
+        Vec_WrdFill( vSims, nSize, 0 );
+    // split the words into slices aligned on the block boundary
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].pSimsPi = Vec_WrdArray(vSimsPi);
+        ThData[i].pSims   = Vec_WrdArray(vSims);
+        ThData[i].pBuffer = fOuts ? ABC_ALLOC( word, (size_t)nBuffer * Gia_ManObjNum(p) ) : NULL;
+        ThData[i].nBuffer = nBuffer;
+        ThData[i].nWords  = nWords;
+        ThData[i].wStart  = Abc_MinInt( nWords, GIA_SIM_BLOCK * (nBlocks * i / nProcs) );
+        ThData[i].wStop   = Abc_MinInt( nWords, GIA_SIM_BLOCK * (nBlocks * (i+1) / nProcs) );
+        ThData[i].fOuts   = fOuts;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 )
+    {
+        pthread_t WorkerThread[GIA_SIM_THR_MAX];
+        for ( i = 0; i < nProcs; i++ )
+        {
+            int status = pthread_create( WorkerThread + i, NULL, Gia_ManSimPatSimThread, (void *)(ThData + i) );  
+            assert( status == 0 ); (void)status;
+        }
+        for ( i = 0; i < nProcs; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+#endif
+        Gia_ManSimPatSimRange( ThData );
+    for ( i = 0; i < nProcs; i++ )
+        ABC_FREE( ThData[i].pBuffer );
+}
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
-    Gia_Obj_t * pObj;
-    int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
-    assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
-    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    Vec_Wrd_t * vSims = Vec_WrdAlloc( 0 );
+    Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, vSims, 0, 1 );
     return vSims;
 }
 Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts )
 {
-    Gia_Obj_t * pObj;
-    int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSimsCo = fOuts ? Vec_WrdStart( Gia_ManCoNum(pGia) * nWords ) : NULL;
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
-    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
-    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
-    Gia_ManForEachAnd( pGia, pObj, i ) 
-        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
-    Gia_ManForEachCo( pGia, pObj, i )
-        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
-    if ( !fOuts )
-        return vSims;
-    Gia_ManForEachCo( pGia, pObj, i )
-        memcpy( Vec_WrdEntryP(vSimsCo, i*nWords), Vec_WrdEntryP(vSims, Gia_ObjId(pGia, pObj)*nWords), sizeof(word)*nWords );
-    Vec_WrdFree( vSims );
-    return vSimsCo;
+    Vec_Wrd_t * vSims = Vec_WrdAlloc( 0 );
+    Gia_ManSimPatSimMt( pGia, vSimsPi, vSims, fOuts, 1 );
+    return vSims;
 }
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
@@ -761,15 +893,21 @@ Gia_Man_t * Gia_ManSimPatGenMiter( Gia_Man_t * p, Vec_Wrd_t * vSims )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimProfile( Gia_Man_t * pGia )
+void Gia_ManSimProfileMt( Gia_Man_t * pGia, int nProcs )
 {
-    Vec_Wrd_t * vSims = Gia_ManSimPatSim( pGia );
-    int nWords = Vec_WrdSize(vSims) / Gia_ManObjNum(pGia);
-    int nC0s = 0, nC1s = 0, nUnique = Gia_ManSimPatHashPatterns( pGia, nWords, vSims, &nC0s, &nC1s );
+    Vec_Wrd_t * vSims = Vec_WrdAlloc( 0 );
+    int nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
+    int nC0s = 0, nC1s = 0, nUnique;
+    Gia_ManSimPatSimMt( pGia, pGia->vSimsPi, vSims, 0, nProcs );
+    nUnique = Gia_ManSimPatHashPatterns( pGia, nWords, vSims, &nC0s, &nC1s );
     printf( "Simulating %d patterns leads to %d unique objects (%.2f %% out of %d). Const0 = %d. Const1 = %d.\n", 
         64*nWords, nUnique, 100.0*nUnique/Gia_ManCandNum(pGia), Gia_ManCandNum(pGia), nC0s, nC1s );
     Vec_WrdFree( vSims );
 }
+void Gia_ManSimProfile( Gia_Man_t * pGia )
+{
+    Gia_ManSimProfileMt( pGia, 1 );
+}
 void Gia_ManPatSatImprove( Gia_Man_t * p, int nWords0, int fVerbose )
 {
     extern Vec_Int_t * Cbs2_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
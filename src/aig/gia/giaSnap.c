@@ -0,0 +1,608 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Binary snapshot of the AIG loaded by memory mapping.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The snapshot stores the arrays of the AIG verbatim. It begins with the
+// header followed by the section table (offset and size in bytes of each
+// section, zero if the section is absent). The sections are aligned at
+// GIA_SNAP_ALIGN bytes. The object array is used in place from the mapped
+// file (the mapping is private, so changes to the objects are not written
+// back); it is copied into the heap when the AIG grows. The remaining
+// arrays are copied into the manager.
+
+#define GIA_SNAP_VERSION  1
+#define GIA_SNAP_ALIGN   64
+#define GIA_SNAP_ENDIAN  0x01020304
+
+typedef enum {
+    GIA_SNAP_OBJS = 0,   // objects (Gia_Obj_t)
+    GIA_SNAP_CIS,        // CI object IDs (int)
+    GIA_SNAP_COS,        // CO object IDs (int)
+    GIA_SNAP_MUXES,      // MUX control literals (unsigned)
+    GIA_SNAP_MAPPING,    // LUT mapping (int)
+    GIA_SNAP_CELLS,      // cell mapping (int)
+    GIA_SNAP_NAMES_IN,   // CI names (zero-terminated strings)
+    GIA_SNAP_NAMES_OUT,  // CO names (zero-terminated strings)
+    GIA_SNAP_NAME,       // the AIG name (zero-terminated string)
+    GIA_SNAP_SPEC,       // the file name (zero-terminated string)
+    GIA_SNAP_IN_ARRS,    // PI arrival times (float)
+    GIA_SNAP_OUT_REQS,   // PO required times (float)
+    GIA_SNAP_TIMING,     // timing manager (Tim_ManSave)
+    GIA_SNAP_NUM
+} Gia_SnapSect_t;
+
+typedef struct Gia_SnapHead_t_ Gia_SnapHead_t;
+struct Gia_SnapHead_t_
+{
+    char           Magic[8];      // "GIASNAP"
+    int            Version;       // format version
+    int            Endian;        // GIA_SNAP_ENDIAN in the byte order of the writer
+    int            ObjSize;       // sizeof(Gia_Obj_t)
+    int            nSects;        // the number of entries in the section table
+    int            nObjs;         // the number of objects
+    int            nRegs;         // the number of registers
+    int            nConstrs;      // the number of constraints
+    int            nXors;         // the number of XORs
+    int            nMuxes;        // the number of MUXes
+    int            nBufs;         // the number of buffers
+    int            fGiaSimple;    // simple mode
+    int            Reserved;      // alignment
+};
+
+typedef struct Gia_SnapSect_t_ Gia_SnapSectEntry_t;
+struct Gia_SnapSect_t_
+{
+    word           Offset;        // offset from the beginning of the file
+    word           Size;          // size in bytes
+};
+
+static char s_GiaSnapMagic[8] = { 'G', 'I', 'A', 'S', 'N', 'A', 'P', 0 };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one section.]
+
+  Description [Pads the file to the alignment and records the section.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SnapWriteSect( FILE * pFile, Gia_SnapSectEntry_t * pSects, int Type, void * pData, word Size )
+{
+    static char Zeros[GIA_SNAP_ALIGN] = {0};
+    word Offset = (word)ftell( pFile );
+    if ( Offset % GIA_SNAP_ALIGN )
+    {
+        fwrite( Zeros, 1, (size_t)(GIA_SNAP_ALIGN - Offset % GIA_SNAP_ALIGN), pFile );
+        Offset += GIA_SNAP_ALIGN - Offset % GIA_SNAP_ALIGN;
+    }
+    pSects[Type].Offset = Offset;
+    pSects[Type].Size   = Size;
+    if ( pData && Size )
+        fwrite( pData, 1, (size_t)Size, pFile );
+}
+static void Gia_SnapWriteNames( FILE * pFile, Gia_SnapSectEntry_t * pSects, int Type, Vec_Ptr_t * vNames )
+{
+    Vec_Str_t * vStr;
+    char * pName;
+    int i;
+    if ( vNames == NULL )
+        return;
+    vStr = Vec_StrAlloc( 1000 );
+    Vec_PtrForEachEntry( char *, vNames, pName, i )
+    {
+        Vec_StrPrintStr( vStr, pName ? pName : "" );
+        Vec_StrPush( vStr, '\0' );
+    }
+    Gia_SnapWriteSect( pFile, pSects, Type, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+    Vec_StrFree( vStr );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the snapshot of the AIG.]
+
+  Description [The objects are written with the marks and values cleared,
+  so that the loaded AIG looks like a new one. The snapshot is written 
+  into a temporary file, which then replaces the output file, because 
+  the output file may be mapped by this AIG or by another one (truncating 
+  it would invalidate their objects). Returns 0 if the file cannot be 
+  written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_SnapSectEntry_t Sects[GIA_SNAP_NUM];
+    Gia_SnapHead_t Head;
+    Gia_Obj_t * pBuffer;
+    FILE * pFile;
+    char * pFileTemp;
+    int i, k, RetValue, nChunk = (1 << 16);
+    pFileTemp = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    sprintf( pFileTemp, "%s.tmp", pFileName );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_ManSnapWrite(): Cannot open the output file \"%s\".\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    if ( p->pAigExtra )
+        printf( "Gia_ManSnapWrite(): Warning: The AIG of the boxes is not saved in the snapshot.\n" );
+    memset( &Head, 0, sizeof(Gia_SnapHead_t) );
+    memset( Sects, 0, sizeof(Gia_SnapSectEntry_t) * GIA_SNAP_NUM );
+    memcpy( Head.Magic, s_GiaSnapMagic, 8 );
+    Head.Version    = GIA_SNAP_VERSION;
+    Head.Endian     = GIA_SNAP_ENDIAN;
+    Head.ObjSize    = (int)sizeof(Gia_Obj_t);
+    Head.nSects     = GIA_SNAP_NUM;
+    Head.nObjs      = Gia_ManObjNum(p);
+    Head.nRegs      = Gia_ManRegNum(p);
+    Head.nConstrs   = p->nConstrs;
+    Head.nXors      = p->nXors;
+    Head.nMuxes     = p->nMuxes;
+    Head.nBufs      = p->nBufs;
+    Head.fGiaSimple = p->fGiaSimple;
+    fwrite( &Head, sizeof(Gia_SnapHead_t), 1, pFile );
+    fwrite( Sects, sizeof(Gia_SnapSectEntry_t), GIA_SNAP_NUM, pFile );
+    // write the objects in chunks with the marks and the values cleared
+    Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_OBJS, NULL, (word)sizeof(Gia_Obj_t) * Gia_ManObjNum(p) );
+    pBuffer = ABC_ALLOC( Gia_Obj_t, nChunk );
+    for ( i = 0; i < Gia_ManObjNum(p); i += nChunk )
+    {
+        int nObjs = Abc_MinInt( nChunk, Gia_ManObjNum(p) - i );
+        memcpy( pBuffer, Gia_ManObj(p, i), sizeof(Gia_Obj_t) * (size_t)nObjs );
+        for ( k = 0; k < nObjs; k++ )
+            pBuffer[k].fMark0 = pBuffer[k].fMark1 = 0, pBuffer[k].Value = 0;
+        fwrite( pBuffer, sizeof(Gia_Obj_t), (size_t)nObjs, pFile );
+    }
+    ABC_FREE( pBuffer );
+    // write the remaining arrays
+    Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_CIS, Vec_IntArray(p->vCis), (word)4 * Vec_IntSize(p->vCis) );
+    Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_COS, Vec_IntArray(p->vCos), (word)4 * Vec_IntSize(p->vCos) );
+    if ( p->pMuxes )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_MUXES, p->pMuxes, (word)4 * Gia_ManObjNum(p) );
+    if ( p->vMapping )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_MAPPING, Vec_IntArray(p->vMapping), (word)4 * Vec_IntSize(p->vMapping) );
+    if ( p->vCellMapping )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_CELLS, Vec_IntArray(p->vCellMapping), (word)4 * Vec_IntSize(p->vCellMapping) );
+    Gia_SnapWriteNames( pFile, Sects, GIA_SNAP_NAMES_IN, p->vNamesIn );
+    Gia_SnapWriteNames( pFile, Sects, GIA_SNAP_NAMES_OUT, p->vNamesOut );
+    if ( p->pName )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_NAME, p->pName, (word)strlen(p->pName) + 1 );
+    if ( p->pSpec )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_SPEC, p->pSpec, (word)strlen(p->pSpec) + 1 );
+    if ( p->vInArrs )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_IN_ARRS, Vec_FltArray(p->vInArrs), (word)4 * Vec_FltSize(p->vInArrs) );
+    if ( p->vOutReqs )
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_OUT_REQS, Vec_FltArray(p->vOutReqs), (word)4 * Vec_FltSize(p->vOutReqs) );
+    if ( p->pManTime )
+    {
+        Vec_Str_t * vStr = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
+        Gia_SnapWriteSect( pFile, Sects, GIA_SNAP_TIMING, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+        Vec_StrFree( vStr );
+    }
+    // update the section table
+    fseek( pFile, sizeof(Gia_SnapHead_t), SEEK_SET );
+    fwrite( Sects, sizeof(Gia_SnapSectEntry_t), GIA_SNAP_NUM, pFile );
+    fclose( pFile );
+    // the old file remains available to the AIGs mapping it until they are deleted
+    RetValue = rename( pFileTemp, pFileName );
+    if ( RetValue != 0 ) // on some platforms, an existing file is not replaced
+    {
+        remove( pFileName );
+        RetValue = rename( pFileTemp, pFileName );
+    }
+    if ( RetValue != 0 )
+    {
+        printf( "Gia_ManSnapWrite(): Cannot replace the output file \"%s\".\n", pFileName );
+        remove( pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    ABC_FREE( pFileTemp );
+    if ( fVerbose )
+    {
+        printf( "Written snapshot with %d objects into file \"%s\".  ", Gia_ManObjNum(p), pFileName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the file is a snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSnapIsFile( char * pFileName )
+{
+    char Magic[8];
+    FILE * pFile = fopen( pFileName, "rb" );
+    int RetValue;
+    if ( pFile == NULL )
+        return 0;
+    RetValue = fread( Magic, 1, 8, pFile ) == 8 && !memcmp( Magic, s_GiaSnapMagic, 8 );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory or reads it into the heap.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_SnapLoadFile( char * pFileName, size_t * pnSize, int * pfMapped )
+{
+    char * pContents;
+    FILE * pFile = fopen( pFileName, "rb" );
+    long nSize;
+    *pfMapped = 0;
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nSize = ftell( pFile );
+    if ( nSize <= 0 )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    *pnSize = (size_t)nSize;
+    if ( (pContents = Gia_FileMap( pFileName, *pnSize )) )
+    {
+        *pfMapped = 1;
+        fclose( pFile );
+        return pContents;
+    }
+    fseek( pFile, 0, SEEK_SET );
+    pContents = ABC_ALLOC( char, *pnSize );
+    if ( fread( pContents, 1, *pnSize, pFile ) != *pnSize )
+        ABC_FREE( pContents );
+    fclose( pFile );
+    return pContents;
+}
+static void Gia_SnapUnloadFile( char * pContents, size_t nSize, int fMapped )
+{
+    if ( fMapped )
+        Gia_FileUnmap( pContents, nSize );
+    else
+        ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the section table is consistent with the file.]
+
+  Description [Checks that each section is within the file, that the 
+  arrays have the expected sizes, that the strings are terminated within 
+  their sections, and that the CI/CO IDs and the mapping entries are in 
+  range. The objects themselves are not checked, so that loading does 
+  not touch them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_SnapCheckMapping( int * pMap, int nSize, int nIndex, int EntryMin, int FaninMax )
+{
+    int i, k, iOffset;
+    if ( nSize < nIndex )
+        return 0;
+    for ( i = 0; i < nIndex; i++ )
+    {
+        if ( (iOffset = pMap[i]) <= 0 )
+        {
+            if ( iOffset < EntryMin )
+                return 0;
+            continue;
+        }
+        // the offset points to the fanin count, the fanins, and the ID of the LUT or cell
+        if ( iOffset < nIndex || iOffset >= nSize || pMap[iOffset] < 0 || pMap[iOffset] >= nSize - iOffset - 1 )
+            return 0;
+        for ( k = 1; k <= pMap[iOffset]; k++ )
+            if ( pMap[iOffset + k] < 0 || pMap[iOffset + k] >= FaninMax )
+                return 0;
+    }
+    return 1;
+}
+static int Gia_SnapCheck( char * pContents, size_t nSize, Gia_SnapHead_t * pHead, Gia_SnapSectEntry_t * pSects )
+{
+    word Start = (word)sizeof(Gia_SnapHead_t) + (word)sizeof(Gia_SnapSectEntry_t) * pHead->nSects;
+    int i, k, * pIds;
+    if ( pHead->nObjs < 1 || pHead->nObjs > (1 << GIA_OBJ_LOG) || pHead->nRegs < 0 )
+        return 0;
+    for ( i = 0; i < GIA_SNAP_NUM; i++ )
+    {
+        if ( pSects[i].Offset == 0 && pSects[i].Size == 0 )
+            continue;
+        if ( pSects[i].Offset < Start || pSects[i].Offset % GIA_SNAP_ALIGN )
+            return 0;
+        if ( pSects[i].Offset > (word)nSize || pSects[i].Size > (word)nSize - pSects[i].Offset )
+            return 0;
+        // the sections other than the objects are copied into the vectors
+        if ( i != GIA_SNAP_OBJS && i != GIA_SNAP_MUXES && pSects[i].Size >= (word)ABC_INT_MAX )
+            return 0;
+    }
+    // the arrays
+    if ( pSects[GIA_SNAP_OBJS].Size != (word)sizeof(Gia_Obj_t) * pHead->nObjs )
+        return 0;
+    if ( pSects[GIA_SNAP_MUXES].Size && pSects[GIA_SNAP_MUXES].Size != (word)4 * pHead->nObjs )
+        return 0;
+    if ( (pSects[GIA_SNAP_CIS].Size | pSects[GIA_SNAP_COS].Size | pSects[GIA_SNAP_MAPPING].Size | pSects[GIA_SNAP_CELLS].Size) % 4 )
+        return 0;
+    if ( (pSects[GIA_SNAP_IN_ARRS].Size | pSects[GIA_SNAP_OUT_REQS].Size) % 4 )
+        return 0;
+    // the strings
+    for ( i = GIA_SNAP_NAMES_IN; i <= GIA_SNAP_SPEC; i++ )
+        if ( pSects[i].Size && pContents[pSects[i].Offset + pSects[i].Size - 1] != '\0' )
+            return 0;
+    // the CI/CO IDs
+    for ( i = GIA_SNAP_CIS; i <= GIA_SNAP_COS; i++ )
+    {
+        pIds = (int *)(pContents + pSects[i].Offset);
+        for ( k = 0; k < (int)(pSects[i].Size / 4); k++ )
+            if ( pIds[k] <= 0 || pIds[k] >= pHead->nObjs )
+                return 0;
+    }
+    if ( (word)pHead->nRegs > pSects[GIA_SNAP_CIS].Size / 4 || (word)pHead->nRegs > pSects[GIA_SNAP_COS].Size / 4 )
+        return 0;
+    // the LUT mapping is indexed by object IDs and the cell mapping by literals
+    if ( pSects[GIA_SNAP_MAPPING].Offset && !Gia_SnapCheckMapping((int *)(pContents + pSects[GIA_SNAP_MAPPING].Offset), 
+            (int)(pSects[GIA_SNAP_MAPPING].Size / 4), pHead->nObjs, 0, pHead->nObjs) )
+        return 0;
+    if ( pSects[GIA_SNAP_CELLS].Offset && (pHead->nObjs > ABC_INT_MAX / 2 || !Gia_SnapCheckMapping((int *)(pContents + pSects[GIA_SNAP_CELLS].Offset), 
+            (int)(pSects[GIA_SNAP_CELLS].Size / 4), 2 * pHead->nObjs, -2, 2 * pHead->nObjs)) )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the sections into the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void * Gia_SnapSect( char * pContents, Gia_SnapSectEntry_t * pSects, int Type )
+{
+    return pSects[Type].Size ? (void *)(pContents + pSects[Type].Offset) : NULL;
+}
+static Vec_Int_t * Gia_SnapReadInts( char * pContents, Gia_SnapSectEntry_t * pSects, int Type )
+{
+    Vec_Int_t * vRes;
+    if ( pSects[Type].Offset == 0 )
+        return NULL;
+    vRes = Vec_IntStart( (int)(pSects[Type].Size / 4) );
+    if ( pSects[Type].Size )
+        memcpy( Vec_IntArray(vRes), Gia_SnapSect(pContents, pSects, Type), (size_t)pSects[Type].Size );
+    return vRes;
+}
+static Vec_Flt_t * Gia_SnapReadFlts( char * pContents, Gia_SnapSectEntry_t * pSects, int Type )
+{
+    Vec_Flt_t * vRes;
+    if ( pSects[Type].Offset == 0 )
+        return NULL;
+    vRes = Vec_FltStart( (int)(pSects[Type].Size / 4) );
+    if ( pSects[Type].Size )
+        memcpy( Vec_FltArray(vRes), Gia_SnapSect(pContents, pSects, Type), (size_t)pSects[Type].Size );
+    return vRes;
+}
+static Vec_Ptr_t * Gia_SnapReadNames( char * pContents, Gia_SnapSectEntry_t * pSects, int Type, int nNames )
+{
+    Vec_Ptr_t * vRes;
+    char * pCur, * pEnd;
+    if ( pSects[Type].Offset == 0 )
+        return NULL;
+    vRes = Vec_PtrAlloc( nNames );
+    pCur = pContents + pSects[Type].Offset;
+    pEnd = pCur + pSects[Type].Size;
+    while ( pCur < pEnd && Vec_PtrSize(vRes) < nNames )
+    {
+        Vec_PtrPush( vRes, Abc_UtilStrsav(pCur) );
+        pCur += strlen(pCur) + 1;
+    }
+    if ( Vec_PtrSize(vRes) == nNames )
+        return vRes;
+    Vec_PtrFreeFree( vRes );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the snapshot of the AIG.]
+
+  Description [If the file is mapped into memory, the objects of the AIG
+  remain in the mapped pages, so loading does not depend on the number
+  of objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManSnapRead( char * pFileName, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_SnapSectEntry_t Sects[GIA_SNAP_NUM];
+    Gia_SnapHead_t * pHead;
+    Gia_Man_t * p;
+    char * pContents, * pTemp;
+    size_t nSize = 0;
+    int fMapped = 0, fValid;
+    pContents = Gia_SnapLoadFile( pFileName, &nSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Gia_ManSnapRead(): Cannot read the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    pHead = (Gia_SnapHead_t *)pContents;
+    if ( nSize < sizeof(Gia_SnapHead_t) || memcmp(pHead->Magic, s_GiaSnapMagic, 8) )
+    {
+        printf( "Gia_ManSnapRead(): The file \"%s\" is not a snapshot.\n", pFileName );
+        Gia_SnapUnloadFile( pContents, nSize, fMapped );
+        return NULL;
+    }
+    if ( pHead->Version != GIA_SNAP_VERSION || pHead->Endian != GIA_SNAP_ENDIAN || pHead->ObjSize != (int)sizeof(Gia_Obj_t) )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot \"%s\" was written by an incompatible version or platform.\n", pFileName );
+        Gia_SnapUnloadFile( pContents, nSize, fMapped );
+        return NULL;
+    }
+    // read the section table (the sections unknown to this version are skipped)
+    memset( Sects, 0, sizeof(Gia_SnapSectEntry_t) * GIA_SNAP_NUM );
+    fValid = pHead->nSects >= 0 && (word)nSize >= (word)sizeof(Gia_SnapHead_t) + (word)sizeof(Gia_SnapSectEntry_t) * pHead->nSects;
+    if ( fValid )
+        memcpy( Sects, pContents + sizeof(Gia_SnapHead_t), sizeof(Gia_SnapSectEntry_t) * Abc_MinInt(pHead->nSects, GIA_SNAP_NUM) );
+    if ( !fValid || !Gia_SnapCheck(pContents, nSize, pHead, Sects) )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot \"%s\" is corrupted.\n", pFileName );
+        Gia_SnapUnloadFile( pContents, nSize, fMapped );
+        return NULL;
+    }
+    // create the manager
+    p = ABC_CALLOC( Gia_Man_t, 1 );
+    p->nObjs      = p->nObjsAlloc = pHead->nObjs;
+    p->nRegs      = pHead->nRegs;
+    p->nConstrs   = pHead->nConstrs;
+    p->nXors      = pHead->nXors;
+    p->nMuxes     = pHead->nMuxes;
+    p->nBufs      = pHead->nBufs;
+    p->fGiaSimple = pHead->fGiaSimple;
+    if ( fMapped )
+    {
+        // the objects are used in place; the mapping is released when the AIG grows or is deleted
+        p->pObjs    = (Gia_Obj_t *)Gia_SnapSect( pContents, Sects, GIA_SNAP_OBJS );
+        p->pSnapMap = pContents;
+        p->nSnapMap = nSize;
+    }
+    else
+    {
+        p->pObjs = ABC_ALLOC( Gia_Obj_t, pHead->nObjs );
+        memcpy( p->pObjs, Gia_SnapSect(pContents, Sects, GIA_SNAP_OBJS), (size_t)Sects[GIA_SNAP_OBJS].Size );
+    }
+    p->vCis = Gia_SnapReadInts( pContents, Sects, GIA_SNAP_CIS );
+    p->vCos = Gia_SnapReadInts( pContents, Sects, GIA_SNAP_COS );
+    if ( p->vCis == NULL ) p->vCis = Vec_IntAlloc( 0 );
+    if ( p->vCos == NULL ) p->vCos = Vec_IntAlloc( 0 );
+    if ( Sects[GIA_SNAP_MUXES].Size )
+    {
+        p->pMuxes = ABC_ALLOC( unsigned, pHead->nObjs );
+        memcpy( p->pMuxes, Gia_SnapSect(pContents, Sects, GIA_SNAP_MUXES), (size_t)Sects[GIA_SNAP_MUXES].Size );
+    }
+    p->vMapping     = Gia_SnapReadInts( pContents, Sects, GIA_SNAP_MAPPING );
+    p->vCellMapping = Gia_SnapReadInts( pContents, Sects, GIA_SNAP_CELLS );
+    p->vNamesIn     = Gia_SnapReadNames( pContents, Sects, GIA_SNAP_NAMES_IN, Gia_ManCiNum(p) );
+    p->vNamesOut    = Gia_SnapReadNames( pContents, Sects, GIA_SNAP_NAMES_OUT, Gia_ManCoNum(p) );
+    p->vInArrs      = Gia_SnapReadFlts( pContents, Sects, GIA_SNAP_IN_ARRS );
+    p->vOutReqs     = Gia_SnapReadFlts( pContents, Sects, GIA_SNAP_OUT_REQS );
+    if ( (pTemp = (char *)Gia_SnapSect(pContents, Sects, GIA_SNAP_NAME)) )
+        p->pName = Abc_UtilStrsav( pTemp );
+    if ( (pTemp = (char *)Gia_SnapSect(pContents, Sects, GIA_SNAP_SPEC)) )
+        p->pSpec = Abc_UtilStrsav( pTemp );
+    if ( Sects[GIA_SNAP_TIMING].Size )
+    {
+        Vec_Str_t * vStr = Vec_StrStart( (int)Sects[GIA_SNAP_TIMING].Size );
+        memcpy( Vec_StrArray(vStr), Gia_SnapSect(pContents, Sects, GIA_SNAP_TIMING), (size_t)Sects[GIA_SNAP_TIMING].Size );
+        p->pManTime = Tim_ManLoad( vStr, 0 );
+        Vec_StrFree( vStr );
+    }
+    if ( !fMapped )
+        Gia_SnapUnloadFile( pContents, nSize, fMapped );
+    if ( fVerbose )
+    {
+        printf( "Loaded snapshot with %d objects from file \"%s\" (%s).  ", Gia_ManObjNum(p), pFileName, fMapped ? "mapped" : "copied" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the mapped snapshot.]
+
+  Description [Gia_ManSnapRelease() moves the objects into the heap before
+  the object array is reallocated. Gia_ManSnapUnmap() is called when the
+  AIG is deleted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSnapRelease( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObjs;
+    assert( p->pSnapMap != NULL );
+    pObjs = ABC_ALLOC( Gia_Obj_t, p->nObjsAlloc );
+    memcpy( pObjs, p->pObjs, sizeof(Gia_Obj_t) * (size_t)p->nObjs );
+    Gia_ManSnapUnmap( p );
+    p->pObjs = pObjs;
+}
+void Gia_ManSnapUnmap( Gia_Man_t * p )
+{
+    assert( p->pSnapMap != NULL );
+    Gia_SnapUnloadFile( p->pSnapMap, p->nSnapMap, 1 );
+    p->pSnapMap = NULL;
+    p->nSnapMap = 0;
+    p->pObjs    = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
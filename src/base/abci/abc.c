@@ -44,6 +44,8 @@
 #include "opt/ret/retInt.h"
 #include "sat/xsat/xsat.h"
 #include "sat/satoko/satoko.h"
+#include "sat/bsat/satBackend.h"
+#include "sat/bsat/satService.h"
 #include "sat/cnf/cnf.h"
 #include "proof/cec/cec.h"
 #include "proof/acec/acec.h"
@@ -357,6 +359,7 @@ static int Abc_CommandDSec                   ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandSat                    ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandDSat                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandXSat                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandSatServ                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandSatoko                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Satoko             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Sat3               ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -421,6 +424,7 @@ static int Abc_CommandAbc9Write              ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9WriteLut           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Ps                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PFan               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Fanout             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Pms                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PSig               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Status             ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -848,6 +852,9 @@ void Abc_FrameUpdateGia( Abc_Frame_t * pAbc, Gia_Man_t * pNew )
         pNew->vNamesNode = pAbc->pGia->vNamesNode;
         pAbc->pGia->vNamesNode = NULL;
     }
+    // keep the static fanout of the new AIG if it was kept for the old one
+    if ( pAbc->pGia && pAbc->pGia->fFanoutKeep )
+        Gia_ManStaticFanoutKeepStart( pNew );
     // update
     if ( pAbc->pGia2 )
         Gia_ManStop( pAbc->pGia2 );
@@ -1176,6 +1183,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Verification", "sat",           Abc_CommandSat,              0 );
     Cmd_CommandAdd( pAbc, "Verification", "dsat",          Abc_CommandDSat,             0 );
     Cmd_CommandAdd( pAbc, "Verification", "xsat",          Abc_CommandXSat,             0 );
+    Cmd_CommandAdd( pAbc, "Verification", "satserv",       Abc_CommandSatServ,          0 );
     Cmd_CommandAdd( pAbc, "Verification", "satoko",        Abc_CommandSatoko,           0 );
     Cmd_CommandAdd( pAbc, "Verification", "&satoko",       Abc_CommandAbc9Satoko,       0 );
     Cmd_CommandAdd( pAbc, "Verification", "&sat3",         Abc_CommandAbc9Sat3,         0 );
@@ -1239,6 +1247,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&wlut",         Abc_CommandAbc9WriteLut,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&ps",           Abc_CommandAbc9Ps,           0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pfan",         Abc_CommandAbc9PFan,         0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&fanout",       Abc_CommandAbc9Fanout,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pms",          Abc_CommandAbc9Pms,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&psig",         Abc_CommandAbc9PSig,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&status",       Abc_CommandAbc9Status,       0 );
@@ -1633,6 +1642,8 @@ int Abc_CommandPrintStats( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Abc_NtkPrintStats( pNtk, fFactor, fSaveBest, fDumpResult, fUseLutLib, fPrintMuxes, fPower, fGlitch, fSkipBuf, fSkipSmall, fPrintMem );
+    if ( fPrintMem )
+        Cmd_ProfPrintUsage( pAbc );
     if ( fPrintTime )
     {
         pAbc->TimeTotal += pAbc->TimeCommand;
@@ -9974,9 +9985,9 @@ usage:
 ***********************************************************************/
 int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int fVerbose );
+    extern Gia_Man_t * Gia_ManFindExactMt( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int nProcs, int fVerbose );
 
-    int c, nMaxDepth = -1, fMakeAIG = 0, fTest = 0, fVerbose = 0, nVars = 0, nVarsTmp, nFunc = 0, nStartGates = 1, nBTLimit = 400000;
+    int c, nMaxDepth = -1, fMakeAIG = 0, fTest = 0, fVerbose = 0, nVars = 0, nVarsTmp, nFunc = 0, nStartGates = 1, nBTLimit = 400000, nProcs = 1;
     char * p1, * p2;
     word pTruth[64];
     int pArrTimeProfile[8], fHasArrTimeProfile = 0;
@@ -9984,7 +9995,7 @@ int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pGiaRes;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "DASCatvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "DASCPatvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -10044,6 +10055,17 @@ int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
             nBTLimit = atoi(argv[globalUtilOptind]);
             globalUtilOptind++;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 )
+                goto usage;
+            break;
         case 'a':
             fMakeAIG ^= 1;
             break;
@@ -10100,7 +10122,7 @@ int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
 
     if ( fMakeAIG )
     {
-        pGiaRes = Gia_ManFindExact( pTruth, nVars, nFunc, nMaxDepth, fHasArrTimeProfile ? pArrTimeProfile : NULL, nBTLimit, nStartGates - 1, fVerbose );
+        pGiaRes = Gia_ManFindExactMt( pTruth, nVars, nFunc, nMaxDepth, fHasArrTimeProfile ? pArrTimeProfile : NULL, nBTLimit, nStartGates - 1, nProcs, fVerbose );
         if ( pGiaRes )
             Abc_FrameUpdateGia( pAbc, pGiaRes );
         else
@@ -10108,7 +10130,7 @@ int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     else
     {
-        pNtkRes = Abc_NtkFindExact( pTruth, nVars, nFunc, nMaxDepth, fHasArrTimeProfile ? pArrTimeProfile : NULL, nBTLimit, nStartGates - 1, fVerbose );
+        pNtkRes = Abc_NtkFindExactMt( pTruth, nVars, nFunc, nMaxDepth, fHasArrTimeProfile ? pArrTimeProfile : NULL, nBTLimit, nStartGates - 1, nProcs, fVerbose );
         if ( pNtkRes )
         {
             Abc_FrameReplaceCurrentNetwork( pAbc, pNtkRes );
@@ -10120,12 +10142,13 @@ int Abc_CommandExact( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: exact [-DSC <num>] [-A <list>] [-atvh] <truth1> <truth2> ...\n" );
+    Abc_Print( -2, "usage: exact [-DSCP <num>] [-A <list>] [-atvh] <truth1> <truth2> ...\n" );
     Abc_Print( -2, "\t           finds optimum networks using SAT-based exact synthesis for hex truth tables <truth1> <truth2> ...\n" );
     Abc_Print( -2, "\t-D <num>  : constrain maximum depth (if too low, algorithm may not terminate)\n" );
     Abc_Print( -2, "\t-A <list> : input arrival times (comma separated list)\n" );
     Abc_Print( -2, "\t-S <num>  : number of start gates in search [default = %d]\n", nStartGates );
     Abc_Print( -2, "\t-C <num>  : the limit on the number of conflicts; turn off with 0 [default = %d]\n", nBTLimit );
+    Abc_Print( -2, "\t-P <num>  : the number of gate counts tried in parallel (without -D) [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-a        : toggle create AIG [default = %s]\n", fMakeAIG ? "yes" : "no" );
     Abc_Print( -2, "\t-t        : run test suite\n" );
     Abc_Print( -2, "\t-v        : toggle verbose printout [default = %s]\n", fVerbose ? "yes" : "no" );
@@ -24392,7 +24415,7 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Ssw_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PQFCLSIVMNXRBcmplkodsefqvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PQTFCLSIVMNXRBcmplkodsefqvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -24407,6 +24430,17 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nPartSize < 2 )
                 goto usage;
             break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
         case 'Q':
             if ( globalUtilOptind >= argc )
             {
@@ -24660,10 +24694,11 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: scorr [-PQFCLSIVMNXRB <num>] [-cmplkodsefqvwh]\n" );
+    Abc_Print( -2, "usage: scorr [-PQTFCLSIVMNXRB <num>] [-cmplkodsefqvwh]\n" );
     Abc_Print( -2, "\t         performs sequential sweep using K-step induction\n" );
     Abc_Print( -2, "\t-P num : max partition size (0 = no partitioning) [default = %d]\n", pPars->nPartSize );
     Abc_Print( -2, "\t-Q num : partition overlap (0 = no overlap) [default = %d]\n", pPars->nOverSize );
+    Abc_Print( -2, "\t-T num : the number of threads to prove partitions (with -P) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-F num : number of time frames for induction (1=simple) [default = %d]\n", pPars->nFramesK );
     Abc_Print( -2, "\t-C num : max number of conflicts at a node (0=inifinite) [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-L num : max number of levels to consider (0=all) [default = %d]\n", pPars->nMaxLevs );
@@ -28662,6 +28697,126 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandSatServ( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Sat_Service_t * pServ = Sat_ServiceGlobal();
+    char * pBackend = NULL;
+    int c, nProcs = 4, nMemLimit = SAT_SERVICE_MEM_MAX, fClear = 0, fStop = 0, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PMBckvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 || nProcs > SAT_SERVICE_THR_MAX )
+                goto usage;
+            break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nMemLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nMemLimit < 0 )
+                goto usage;
+            break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by a solver name.\n" );
+                goto usage;
+            }
+            pBackend = argv[globalUtilOptind];
+            globalUtilOptind++;
+            if ( Sat_BackendFindType(pBackend) == -1 )
+            {
+                Abc_Print( -1, "Unknown SAT solver \"%s\" (expected one of: ", pBackend );
+                Sat_BackendPrintTypes();
+                Abc_Print( -2, ").\n" );
+                return 1;
+            }
+            break;
+        case 'c':
+            fClear ^= 1;
+            break;
+        case 'k':
+            fStop ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( fClear )
+    {
+        if ( pServ == NULL )
+        {
+            Abc_Print( -1, "The SAT service is not running.\n" );
+            return 1;
+        }
+        if ( fVerbose )
+            Sat_ServicePrintStats( pServ );
+        Sat_ServiceClear( pServ );
+        return 0;
+    }
+    if ( fStop )
+    {
+        if ( pServ && fVerbose )
+            Sat_ServicePrintStats( pServ );
+        Sat_ServiceSetGlobal( NULL );
+        return 0;
+    }
+    if ( pServ && fVerbose )
+    {
+        Sat_ServicePrintStats( pServ );
+        return 0;
+    }
+    pServ = Sat_ServiceStart( nProcs, pBackend ? Sat_BackendFindType(pBackend) : SAT_BACKEND_BSAT, nMemLimit );
+    Sat_ServiceSetGlobal( pServ );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: satserv [-PMB <num>] [-ckvh]\n" );
+    Abc_Print( -2, "\t         starts the SAT solving service shared by the commands (e.g. \"&sat -p\")\n" );
+    Abc_Print( -2, "\t         the service solves the submitted jobs (CNF + assumptions) using a pool of\n" );
+    Abc_Print( -2, "\t         workers and keeps the results, so that repeated jobs are not solved again\n" );
+    Abc_Print( -2, "\t-P num : the number of workers [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-M num : the memory limit of the cached CNFs and results in MB (0 = no limit) [default = %d]\n", nMemLimit );
+    Abc_Print( -2, "\t-B name: the SAT solver used by the workers [default = %s]\n", pBackend ? pBackend : "bsat" );
+    Abc_Print( -2, "\t         (available solvers: " );
+    Sat_BackendPrintTypes();
+    Abc_Print( -2, ")\n" );
+    Abc_Print( -2, "\t-c     : toggle clearing the cached CNFs and results [default = %s]\n", fClear? "yes": "no" );
+    Abc_Print( -2, "\t-k     : toggle stopping the service [default = %s]\n", fStop? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing the statistics of the running service [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -29858,10 +30013,11 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     Vec_Int_t * vStatuses = NULL;
     char * pLogFileName = NULL;
     int fOrDecomp = 0;
+    int fKeepSession = 0;
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWBaxdurskgvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30015,6 +30171,27 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             pPars->pLogFileName = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by a solver name.\n" );
+                goto usage;
+            }
+            pPars->pBackend = argv[globalUtilOptind];
+            globalUtilOptind++;
+            if ( Sat_BackendFindType(pPars->pBackend) == -1 )
+            {
+                Abc_Print( -1, "Unknown SAT solver \"%s\" (expected one of: ", pPars->pBackend );
+                Sat_BackendPrintTypes();
+                Abc_Print( -2, ").\n" );
+                return 1;
+            }
+            if ( !Sat_BackendTypeIsIncremental(Sat_BackendFindType(pPars->pBackend)) )
+            {
+                Abc_Print( -1, "SAT solver \"%s\" is not incremental and cannot be used by BMC.\n", pPars->pBackend );
+                return 1;
+            }
+            break;
         case 'a':
             pPars->fSolveAll ^= 1;
             break;
@@ -30033,6 +30210,9 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             pPars->fUseSatoko ^= 1;
             break;
+        case 'k':
+            fKeepSession ^= 1;
+            break;
         case 'g':
             pPars->fUseGlucose ^= 1;
             break;
@@ -30073,6 +30253,13 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( 1, "The miters is already solved; skipping the command.\n" ); 
         return 0;
     }
+    if ( fKeepSession )
+        pPars->ppSession = &pAbc->pBmc3Session;
+    else
+    {
+        Saig_ManBmcSessionStop( pAbc->pBmc3Session );
+        pAbc->pBmc3Session = NULL;
+    }
     pPars->fUseBridge = pAbc->fBridgeMode;
     pAbc->Status = Abc_NtkDarBmc3( pNtk, pPars, fOrDecomp );
     pAbc->nFrames = pNtk->vSeqModelVec ? -1 : pPars->iFrame;
@@ -30107,7 +30294,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-B name] [-axdurskgvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -30123,12 +30310,17 @@ usage:
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
+    Abc_Print( -2, "\t-B name: the incremental SAT solver to use (overrides \"-s\" and \"-g\") [default = %s]\n", pPars->pBackend ? pPars->pBackend : "built-in" );
+    Abc_Print( -2, "\t         available solvers: " );
+    Sat_BackendPrintTypes();
+    Abc_Print( -2, "\n" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggle storing CEXes when solving all outputs [default = %s]\n",   pPars->fStoreCex? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dropping (replacing by 0) SAT outputs [default = %s]\n",    pPars->fDropSatOuts? "yes": "no" );
     Abc_Print( -2, "\t-u     : toggle performing structural OR-decomposition [default = %s]\n",   fOrDecomp? "yes": "not" );
     Abc_Print( -2, "\t-r     : toggle disabling periodic restarts [default = %s]\n",              pPars->fNoRestarts? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using Satoko by Bruno Schmitt [default = %s]\n", pPars->fUseSatoko? "yes": "no" );
+    Abc_Print( -2, "\t-k     : toggle keeping the unrolling and the solver for the next call [default = %s]\n", fKeepSession? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n",pPars->fUseGlucose? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n",                           pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle suppressing report about solved outputs [default = %s]\n",  pPars->fNotVerbose? "yes": "no" );
@@ -30158,7 +30350,7 @@ int Abc_CommandBmcInter( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Inter_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CFTKLIrtpomcgbqkdivh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CFTKLIrtpomcgbqksdivh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30254,6 +30446,9 @@ int Abc_CommandBmcInter( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'k':
             pPars->fUseSeparate ^= 1;
             break;
+        case 's':
+            pPars->fUseStream ^= 1;
+            break;
         case 'd':
             pPars->fDropSatOuts ^= 1;
             break;
@@ -30346,7 +30541,7 @@ int Abc_CommandBmcInter( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: int [-CFTK num] [-LI file] [-irtpomcgbqkdvh]\n" );
+    Abc_Print( -2, "usage: int [-CFTK num] [-LI file] [-irtpomcgbqksdvh]\n" );
     Abc_Print( -2, "\t         uses interpolation to prove the property\n" );
     Abc_Print( -2, "\t-C num : the limit on conflicts for one SAT run [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-F num : the limit on number of frames to unroll [default = %d]\n", pPars->nFramesMax );
@@ -30366,6 +30561,7 @@ usage:
     Abc_Print( -2, "\t-b     : toggle using backward interpolation (works with -t) [default = %s]\n", pPars->fUseBackward? "yes": "no" );
     Abc_Print( -2, "\t-q     : toggle using property in two last timeframes [default = %s]\n", pPars->fUseTwoFrames? "yes": "no" );
     Abc_Print( -2, "\t-k     : toggle solving each output separately [default = %s]\n", pPars->fUseSeparate? "yes": "no" );
+    Abc_Print( -2, "\t-s     : toggle streaming learned clauses into a trace file [default = %s]\n", pPars->fUseStream? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle dropping (replacing by 0) SAT outputs (with -k is used) [default = %s]\n", pPars->fDropSatOuts? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -33220,8 +33416,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSkipStrash = 0;
     int fNewReader = 0;
     int fDetectXors = 0;
+    int fSnapshot = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpkvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -33246,6 +33443,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'p':
             fNewReader ^= 1;
             break;
+        case 'k':
+            fSnapshot ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -33277,7 +33477,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     fclose( pFile );
 
-    if ( fNewReader )
+    if ( fSnapshot || Gia_ManSnapIsFile( FileName ) )
+        pAig = Gia_ManSnapRead( FileName, fVerbose );
+    else if ( fNewReader )
         pAig = Gia_FileSimpleRead( FileName, fGiaSimple, NULL );
     else if ( fMiniAig )
         pAig = Gia_ManReadMiniAig( FileName, fGiaSimple || fSkipStrash );
@@ -33302,7 +33504,7 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csxmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-csxmnlkvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
@@ -33310,6 +33512,8 @@ usage:
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggles reading MiniAIG as a set of supergates [default = %s]\n", fMiniAig2? "yes": "no" );
     Abc_Print( -2, "\t-l     : toggles reading MiniLUT rather than AIGER file [default = %s]\n", fMiniLut? "yes": "no" );
+    Abc_Print( -2, "\t-k     : toggles reading the snapshot written by \"&w -k\" [default = %s]\n", fSnapshot? "yes": "no" );
+    Abc_Print( -2, "\t         (the snapshot is also detected automatically and loaded by mapping the file)\n" );
     Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -34380,9 +34584,10 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fWriteNewLine = 0;
     int fReverse = 0;
     int fSkipComment = 0;
+    int fSnapshot = 0;
     int fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "upqicabmlnrsvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "upqicabmlnrskvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -34422,6 +34627,9 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             fSkipComment ^= 1;
             break;
+        case 'k':
+            fSnapshot ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -34458,12 +34666,14 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
         Gia_ManWriteMiniAig( pAbc->pGia, pFileName );
     else if ( fMiniLut )
         Gia_ManWriteMiniLut( pAbc->pGia, pFileName );
+    else if ( fSnapshot )
+        Gia_ManSnapWrite( pAbc->pGia, pFileName, fVerbose );
     else
         Gia_AigerWriteS( pAbc->pGia, pFileName, 0, 0, fWriteNewLine, fSkipComment );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-upqicabmlnsvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-upqicabmlnskvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
@@ -34477,6 +34687,7 @@ usage:
     Abc_Print( -2, "\t-n     : toggle writing \'\\n\' after \'c\' in the AIGER file [default = %s]\n", fWriteNewLine? "yes": "no" );
     //Abc_Print( -2, "\t-r     : toggle reversing the order of input/output bits [default = %s]\n", fReverse? "yes": "no" );    
     Abc_Print( -2, "\t-s     : toggle skipping the timestamp in the output file [default = %s]\n", fSkipComment? "yes": "no" );
+    Abc_Print( -2, "\t-k     : toggle writing the binary snapshot loaded by \"&r\" without parsing [default = %s]\n", fSnapshot? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -34710,6 +34921,81 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Fanout( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Gia_Man_t * p;
+    int c, fKeep = -1, fBuild = 0, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "kubvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'k':
+            fKeep = 1;
+            break;
+        case 'u':
+            fKeep = 0;
+            break;
+        case 'b':
+            fBuild ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Fanout(): There is no AIG.\n" );
+        return 1;
+    }
+    p = pAbc->pGia;
+    if ( fKeep == 1 )
+        Gia_ManStaticFanoutKeepStart( p );
+    else if ( fKeep == 0 && p->fFanoutKeep )
+        Gia_ManStaticFanoutKeepStop( p );
+    if ( fBuild && p->fFanoutKeep )
+        Gia_ManStaticFanoutStart( p );
+    if ( fVerbose )
+    {
+        if ( !p->fFanoutKeep )
+            Abc_Print( 1, "The static fanout is not kept.\n" );
+        else if ( p->nFanoutObjs == 0 )
+            Abc_Print( 1, "The static fanout is kept but not built.\n" );
+        else
+            Abc_Print( 1, "The static fanout is kept for %d objects (%d edges, %.2f MB).\n", 
+                p->nFanoutObjs, Vec_IntSum(p->vFanoutNums), 
+                4.0 * (Vec_IntCap(p->vFanout) + Vec_IntCap(p->vFanoutNums)) / (1<<20) );
+    }
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &fanout [-kubvh]\n" );
+    Abc_Print( -2, "\t         controls the static fanout kept by the current AIG and its derivatives\n" );
+    Abc_Print( -2, "\t         (the kept fanout is updated as nodes are added and shared by the commands)\n" );
+    Abc_Print( -2, "\t-k     : start keeping the static fanout\n" );
+    Abc_Print( -2, "\t-u     : stop keeping the static fanout\n" );
+    Abc_Print( -2, "\t-b     : toggle building the kept static fanout now [default = %s]\n", fBuild? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing the status of the static fanout [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -35505,8 +35791,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fStrMuxes  = 0;
     int fRehashMap = 0;
     int fInvert    = 0;
+    int fInPlace   = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "LMbacmrsih" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LMbacmrsiph" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35553,6 +35840,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'i':
             fInvert ^= 1;
             break;
+        case 'p':
+            fInPlace ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -35636,6 +35926,12 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( !Abc_FrameReadFlag("silentmode") )
             printf( "Generated AIG from AND/XOR/MUX graph.\n" );
     }
+    else if ( fInPlace && !fAddStrash && Gia_ManRehashInPlace( pAbc->pGia ) )
+    {
+        // the saved AIG is no longer the one preceding the current AIG
+        Gia_ManStopP( &pAbc->pGia2 );
+        return 0;
+    }
     else
     {
         pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
@@ -35652,7 +35948,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-LM num] [-bacmrsih]\n" );
+    Abc_Print( -2, "usage: &st [-LM num] [-bacmrsiph]\n" );
     Abc_Print( -2, "\t         performs structural hashing\n" );
     Abc_Print( -2, "\t-b     : toggle adding buffers at the inputs and outputs [default = %s]\n", fAddBuffs? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
@@ -35664,6 +35960,7 @@ usage:
     Abc_Print( -2, "\t-r     : toggle rehashing AIG while preserving mapping [default = %s]\n", fRehashMap? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using MUX restructuring [default = %s]\n", fStrMuxes? "yes": "no" );
     Abc_Print( -2, "\t-i     : toggle complementing the POs of the AIG [default = %s]\n", fInvert? "yes": "no" );
+    Abc_Print( -2, "\t-p     : toggle rehashing the AIG in place (no copy is saved for \"&undo\") [default = %s]\n", fInPlace? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
@@ -36892,11 +37189,11 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9ReadSim( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    int c, fOutputs = 0, nWords = 4, fTruth = 0, fReverse = 0, fVerbose = 0;
+    int c, fOutputs = 0, nWords = 4, nProcs = 1, fTruth = 0, fReverse = 0, fVerbose = 0;
     char ** pArgvNew;
     int nArgcNew;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Wtrovh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WPtrovh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36911,6 +37208,17 @@ int Abc_CommandAbc9ReadSim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nWords < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 't':
             fTruth ^= 1;
             break;
@@ -36949,7 +37257,8 @@ int Abc_CommandAbc9ReadSim( Abc_Frame_t * pAbc, int argc, char ** argv )
         Vec_WrdFreeP( &pAbc->pGia->vSimsPi );
         pAbc->pGia->vSimsPi = fReverse ? Vec_WrdStartTruthTablesRev( Gia_ManCiNum(pAbc->pGia) ) : Vec_WrdStartTruthTables( Gia_ManCiNum(pAbc->pGia) );
         Vec_WrdFreeP( &pAbc->pGia->vSimsPo );
-        pAbc->pGia->vSimsPo = Gia_ManSimPatSimOut( pAbc->pGia, pAbc->pGia->vSimsPi, 1 );
+        pAbc->pGia->vSimsPo = Vec_WrdAlloc( 0 );
+        Gia_ManSimPatSimMt( pAbc->pGia, pAbc->pGia->vSimsPi, pAbc->pGia->vSimsPo, 1, nProcs );
         return 0;
     }
     pArgvNew = argv + globalUtilOptind;
@@ -36990,9 +37299,10 @@ int Abc_CommandAbc9ReadSim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim_read [-W num] [-trovh] <file>\n" );
+    Abc_Print( -2, "usage: &sim_read [-WP num] [-trovh] <file>\n" );
     Abc_Print( -2, "\t         reads simulation patterns from file\n" );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-P num : the number of threads for exhaustive simulation [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-t     : toggle creating exhaustive simulation info [default = %s]\n", fTruth? "yes": "no" );
     Abc_Print( -2, "\t-r     : toggle reversing MSB and LSB input variables [default = %s]\n", fReverse? "yes": "no" );
     Abc_Print( -2, "\t-o     : toggle reading output information [default = %s]\n", fOutputs? "yes": "no" );
@@ -37197,13 +37507,13 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9GenSim( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern void Gia_ManSimProfile( Gia_Man_t * pGia );
+    extern void Gia_ManSimProfileMt( Gia_Man_t * pGia, int nProcs );
     extern void Gia_ManPatSatImprove( Gia_Man_t * pGia, int nWords, int fVerbose );
     extern void Gia_ManPatDistImprove( Gia_Man_t * p, int fVerbose );
     extern void Gia_ManPatRareImprove( Gia_Man_t * p, int RareLimit, int fVerbose );
-    int c, nWords = 4, nRare = -1, fDist = 0, fSatBased = 0, fVerbose = 0;
+    int c, nWords = 4, nRare = -1, nProcs = 1, fDist = 0, fSatBased = 0, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WRsdvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WRPsdvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -37229,6 +37539,17 @@ int Abc_CommandAbc9GenSim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nRare < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 's':
             fSatBased ^= 1;
             break;
@@ -37288,14 +37609,15 @@ int Abc_CommandAbc9GenSim( Abc_Frame_t * pAbc, int argc, char ** argv )
         pAbc->pGia->vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(pAbc->pGia) * nWords );
         printf( "Generated %d random patterns (%d 64-bit data words) for each input of the AIG.\n", 64*nWords, nWords );
     }
-    Gia_ManSimProfile( pAbc->pGia );
+    Gia_ManSimProfileMt( pAbc->pGia, nProcs );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim_gen [-WR num] [-sdvh]\n" );
+    Abc_Print( -2, "usage: &sim_gen [-WRP num] [-sdvh]\n" );
     Abc_Print( -2, "\t         generates random simulation patterns\n" );
     Abc_Print( -2, "\t-W num : the number of 64-bit words of simulation info [default = %d]\n",            nWords );
     Abc_Print( -2, "\t-R num : the rarity parameter used to define scope [default = %d]\n",                nRare );
+    Abc_Print( -2, "\t-P num : the number of threads used to simulate the patterns [default = %d]\n",      nProcs );
     Abc_Print( -2, "\t-s     : toggle using SAT-based improvement of available patterns [default = %s]\n", fSatBased? "yes": "no" );
     Abc_Print( -2, "\t-d     : toggle using one improvement of available patterns [default = %s]\n",       fDist? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",                      fVerbose? "yes": "no" );
@@ -40365,7 +40687,7 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fNewSolver = 0, fNewSolver2 = 0, fCSat = 0, f0Proved = 0, nRestarts = 1;
     Cec_ManSatSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JCRSNanmtcxyzvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JCRSNanmtcxyzpvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -40448,6 +40770,9 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'z':
             f0Proved ^= 1;
             break;
+        case 'p':
+            pPars->fUseService ^= 1;
+            break;
         case 'v':
             pPars->fVerbose ^= 1;
             break;
@@ -40460,6 +40785,11 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sat(): There is no AIG.\n" );
         return 1;
     }
+    if ( pPars->fUseService && Sat_ServiceGlobal() == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Sat(): The SAT service is not started (use \"satserv\").\n" );
+        return 1;
+    }
     if ( fCSat )
     {
         Vec_Int_t * vCounters;
@@ -40491,7 +40821,7 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sat [-JCRSN <num>] [-anmctxzvh]\n" );
+    Abc_Print( -2, "usage: &sat [-JCRSN <num>] [-anmctxzpvh]\n" );
     Abc_Print( -2, "\t         performs SAT solving for the combinational outputs\n" );
     Abc_Print( -2, "\t-J num : the SAT solver type [default = %d]\n", pPars->SolverType );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
@@ -40506,6 +40836,7 @@ usage:
     Abc_Print( -2, "\t-x     : toggle using new solver [default = %s]\n", fNewSolver? "yes": "no" );
     Abc_Print( -2, "\t-y     : toggle using new solver [default = %s]\n", fNewSolver2? "yes": "no" );
     Abc_Print( -2, "\t-z     : toggle replacing proved cones by const0 [default = %s]\n", f0Proved? "yes": "no" );
+    Abc_Print( -2, "\t-p     : toggle solving through the SAT service (see \"satserv\") [default = %s]\n", pPars->fUseService? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -40737,7 +41068,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCbs = 1, approxLim = 600, subBatchSz = 1, adaRecycle = 500, nMaxNodes = 0;
     Cec4_ManSetParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMFrmdckngxysopwqvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMTFSrmdckngxysopwqvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -40851,6 +41182,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nMaxNodes < 0 )
                 goto usage;
             break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'F':
             if ( globalUtilOptind >= argc )
             {
@@ -40860,6 +41202,15 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             pPars->pDumpName = argv[globalUtilOptind];
             globalUtilOptind++;
             break;            
+        case 'S':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-S\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pPatDbName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'r':
             pPars->fRewriting ^= 1;
             break;
@@ -40941,7 +41292,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-JWRILDCNPM <num>] [-F filename] [-rmdckngxysopwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-JWRILDCNPMT <num>] [-FS filename] [-rmdckngxysopwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-J num : the solver type [default = %d]\n", pPars->jType );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
@@ -40953,7 +41304,9 @@ usage:
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
     Abc_Print( -2, "\t-P num : the number of pattern generation iterations [default = %d]\n", pPars->nGenIters );
     Abc_Print( -2, "\t-M num : the node count limit to call the old sweeper [default = %d]\n", nMaxNodes );
+    Abc_Print( -2, "\t-T num : the number of threads for refining classes (with -x) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-F file: the file name to dump primary output information [default = none]\n" );
+    Abc_Print( -2, "\t-S file: the file name of the simulation pattern database (with -x) [default = none]\n" );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using double output miters [default = %s]\n", pPars->fDualOut? "yes": "no" );
@@ -49829,10 +50182,10 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent );
-    int c, nProcs = 1, nTimeOut = 10, nIterMax = 0, LookAhead = 1, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
+    extern int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubes, int fVerbose, int fVeryVerbose, int fSilent );
+    int c, nProcs = 1, nTimeOut = 10, nIterMax = 0, LookAhead = 1, nCubes = 0, fVerbose = 0, fVeryVerbose = 0, fSilent = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PTILsvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PTILCsvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -49883,6 +50236,17 @@ int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCubes = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCubes < 0 )
+                goto usage;
+            break;
         case 's':
             fSilent ^= 1;
             break;
@@ -49908,17 +50272,18 @@ int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9SplitProve(): The problem is sequential.\n" );
         return 1;
     }
-    pAbc->Status = Cec_GiaSplitTest( pAbc->pGia, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+    pAbc->Status = Cec_GiaSplitTest( pAbc->pGia, nProcs, nTimeOut, nIterMax, LookAhead, nCubes, fVerbose, fVeryVerbose, fSilent );
     pAbc->pCex = pAbc->pGia->pCexComb;  pAbc->pGia->pCexComb = NULL;
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &splitprove [-PTIL num] [-svwh]\n" );
+    Abc_Print( -2, "usage: &splitprove [-PTILC num] [-svwh]\n" );
     Abc_Print( -2, "\t         proves CEC problem by case-splitting\n" );
     Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n",          nProcs );
     Abc_Print( -2, "\t-T num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut );
     Abc_Print( -2, "\t-I num : the max number of iterations (0 = infinity) [default = %d]\n", nIterMax );
     Abc_Print( -2, "\t-L num : maximum look-ahead during cofactoring [default = %d]\n",       LookAhead );
+    Abc_Print( -2, "\t-C num : the number of cubes for cube-and-conquer (0 = not used) [default = %d]\n", nCubes );
     Abc_Print( -2, "\t-s     : enable silent computation (no reporting) [default = %s]\n",    fSilent? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",         fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing more verbose information [default = %s]\n",    fVeryVerbose? "yes": "no" );
@@ -50324,7 +50689,7 @@ usage:
     Abc_Print( -2, "\t-K num : the maximum cut size for CNF computation [default = %d]\n",    pPars->nLutSize );
     Abc_Print( -2, "\t-d     : toggle dumping unfolded timeframes [default = %s]\n",          pPars->fDumpFrames?  "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle synthesizing unrolled timeframes [default = %s]\n",     pPars->fUseSynth?    "yes": "no" );
-    Abc_Print( -2, "\t-c     : toggle using old CNF computation [default = %s]\n",            pPars->fUseOldCnf?   "yes": "no" );
+    Abc_Print( -2, "\t-c     : toggle using fast GIA-based CNF computation [default = %s]\n",            pPars->fUseOldCnf?   "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",         pPars->fVerbose?     "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing information about unfolding [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -50355,6 +50720,7 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nTimeOut      =    0;  // timeout in seconds
     pPars->nLutSize      =    0;  // max LUT size for CNF computation
     pPars->nProcs        =    1;  // the number of parallel solvers
+    pPars->nWinSize      =    0;  // the number of frames in a window
     pPars->fLoadCnf      =    0;  // dynamic CNF loading
     pPars->fDumpFrames   =    0;  // dump unrolled timeframes
     pPars->fUseSynth     =    0;  // use synthesis
@@ -50370,7 +50736,7 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->pFuncOnFrameDone = pAbc->pFuncOnFrameDone; // frame done callback
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PCFATgevwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PCFAWTgevwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -50418,6 +50784,17 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nFramesAdd < 0 )
                 goto usage;
             break;
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nWinSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nWinSize < 0 )
+                goto usage;
+            break;
         case 'T':
             if ( globalUtilOptind >= argc )
             {
@@ -50452,23 +50829,34 @@ int Abc_CommandAbc9SBmc( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Bmcs(): There is no AIG.\n" );
         return 0;
     }
-    if ( pPars->nProcs > 4 )
+    if ( pPars->nProcs > 4 && !pPars->nWinSize )
     {
         Abc_Print( -1, "Abc_CommandAbc9Bmcs(): Currently this command can run at most 4 concurrent solvers.\n" );
         return 0;
     }
+    if ( pPars->nProcs < 1 || pPars->nProcs > 99 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Bmcs(): The number of solvers should be between 1 and 99.\n" );
+        return 0;
+    }
+    if ( pPars->nWinSize && pPars->fUseGlucose )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Bmcs(): Checking windows of frames is currently implemented only for Satoko.\n" );
+        return 0;
+    }
     pAbc->Status  = pPars->fUseGlucose ? Bmcg_ManPerform(pAbc->pGia, pPars) : Bmcs_ManPerform(pAbc->pGia, pPars);
     pAbc->nFrames = pPars->iFrame;
     Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexSeq );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &bmcs [-PCFAT num] [-gevwh]\n" );
+    Abc_Print( -2, "usage: &bmcs [-PCFAWT num] [-gevwh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking\n" );
     Abc_Print( -2, "\t-P num : the number of parallel solvers [default = %d]\n",              pPars->nProcs );
     Abc_Print( -2, "\t-C num : the SAT solver conflict limit [default = %d]\n",               pPars->nConfLimit );
     Abc_Print( -2, "\t-F num : the maximum number of timeframes [default = %d]\n",            pPars->nFramesMax );
     Abc_Print( -2, "\t-A num : the number of additional frames to unroll [default = %d]\n",   pPars->nFramesAdd );
+    Abc_Print( -2, "\t-W num : the number of frames checked by each solver in a window (0 = no windows) [default = %d]\n", pPars->nWinSize );
     Abc_Print( -2, "\t-T num : approximate timeout in seconds [default = %d]\n",              pPars->nTimeOut );
     Abc_Print( -2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n", pPars->fUseGlucose?  "Glucose" : "Satoko" );
     Abc_Print( -2, "\t-e     : toggle using variable eliminatation [default = %s]\n",         pPars->fUseEliminate?"yes": "no" );
@@ -31,6 +31,16 @@
 #include "proof/cec/cec.h"
 #include "sat/bsat/satSolver.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -277,6 +287,9 @@ struct Ses_Man_t_
     int          nUndefCalls;           /* number of UNDEF calls */
 
     int          nDebugOffset;          /* for debug printing */
+
+    int          nProcs;                /* number of gate counts tried concurrently */
+    int *        pStop;                 /* flag to cancel the SAT solver (or NULL) */
 };
 
 /***********************************************************************
@@ -1107,6 +1120,8 @@ static void Ses_ManCreateVars( Ses_Man_t * pSes, int nGates )
         sat_solver_restart( pSes->pSat );
     else
         pSes->pSat = sat_solver_new();
+    if ( pSes->pStop )
+        sat_solver_set_stop( pSes->pSat, pSes->pStop );
     sat_solver_setnvars( pSes->pSat, pSes->nSimVars + pSes->nOutputVars + pSes->nGateVars + pSes->nSelectVars + pSes->nDepthVars );
 }
 
@@ -2354,6 +2369,138 @@ static char * Ses_ManFindMinimumSizeTopDown( Ses_Man_t * pSes, int nMinGates )
     return pSol;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Find minimum size by trying several gate counts concurrently.]
+
+  Description [Each window of nProcs consecutive gate counts is solved
+               by separate managers in separate threads. When a count is
+               decided (solution found, impossible, or resource limit),
+               the solvers working on larger counts are cancelled, since
+               their results cannot change the outcome. The cancel flags
+               are kept in the thread data of this call. Each manager 
+               gets a copy of the decomposition found for the spec.]
+
+***********************************************************************/
+#define SES_PAR_MAX 64
+
+typedef struct Ses_ParThData_t_ Ses_ParThData_t;
+struct Ses_ParThData_t_
+{
+    Ses_Man_t *       pSes;             /* manager of this thread */
+    Ses_ParThData_t * pWin;             /* data of all threads in the window */
+    int               iWin;             /* index of this thread in the window */
+    int               nWin;             /* number of threads in the window */
+    int               nGates;           /* number of gates to try */
+    int               fStop;            /* the SAT solver of this thread is cancelled */
+    int               fRes;             /* result of the CEGAR call */
+    char *            pSol;             /* solution if found */
+};
+
+static void Ses_ManParSolveOne( Ses_ParThData_t * pData )
+{
+    int k;
+    pData->fRes = Ses_ManFindNetworkExactCEGAR( pData->pSes, pData->nGates, &pData->pSol );
+    if ( pData->fRes != 2 )
+        for ( k = pData->iWin + 1; k < pData->nWin; k++ )
+            pData->pWin[k].fStop = 1;
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Ses_ManParWorkerThread( void * pArg )
+{
+    Ses_ManParSolveOne( (Ses_ParThData_t *)pArg );
+    return NULL;
+}
+#endif
+
+static char * Ses_ManFindMinimumSizeParallel( Ses_Man_t * pSes )
+{
+    Ses_ParThData_t ThData[SES_PAR_MAX];
+    int i, nProcs = Abc_MinInt( pSes->nProcs, SES_PAR_MAX );
+    int nGates = pSes->nStartGates, fDone = 0;
+    char * pSol = NULL;
+
+    pSes->fHitResLimit = 0;
+    if ( Vec_IntSize( pSes->vStairDecVars ) )
+        nGates = Abc_MaxInt( nGates, Vec_IntSize( pSes->vStairDecVars ) - 1 );
+
+    /* the specification is already normalized, so the copies are not inverted again */
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Ses_Man_t * p = Ses_ManAlloc( pSes->pSpec, pSes->nSpecVars, pSes->nSpecFunc, -1, NULL, pSes->fMakeAIG, pSes->nBTLimit, 0 );
+        assert( p->bSpecInv == 0 );
+        p->bSpecInv      = pSes->bSpecInv;
+        p->pStop         = &ThData[i].fStop;
+        /* the same decomposition as in the sequential search */
+        p->fDecStructure = pSes->fDecStructure;
+        Vec_IntClear( p->vStairDecVars );
+        Vec_IntAppend( p->vStairDecVars, pSes->vStairDecVars );
+        memcpy( p->pStairDecFunc, pSes->pStairDecFunc, sizeof(pSes->pStairDecFunc) );
+        ThData[i].pSes = p;
+        ThData[i].pWin = ThData;
+        ThData[i].iWin = i;
+        ThData[i].nWin = nProcs;
+    }
+
+    while ( !fDone )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            ThData[i].fStop  = 0;
+            ThData[i].nGates = nGates + 1 + i;
+            ThData[i].fRes   = 2;
+            ThData[i].pSol   = NULL;
+        }
+#ifdef ABC_USE_PTHREADS
+        {
+            pthread_t WorkerThread[SES_PAR_MAX];
+            for ( i = 0; i < nProcs; i++ )
+            {
+                int status = pthread_create( WorkerThread + i, NULL, Ses_ManParWorkerThread, (void *)(ThData + i) );
+                assert( status == 0 ); (void)status;
+            }
+            for ( i = 0; i < nProcs; i++ )
+                pthread_join( WorkerThread[i], NULL );
+        }
+#else
+        for ( i = 0; i < nProcs; i++ )
+            if ( !ThData[i].fStop )
+                Ses_ManParSolveOne( ThData + i );
+#endif
+        /* the smallest decided gate count determines the outcome */
+        for ( i = 0; i < nProcs && !fDone; i++ )
+        {
+            if ( ThData[i].fRes == 2 )
+                continue;
+            if ( ThData[i].fRes == 0 )
+                pSes->fHitResLimit = 1;
+            else if ( ThData[i].fRes == 1 )
+                ABC_SWAP( char *, pSol, ThData[i].pSol );
+            fDone = 1;
+        }
+        for ( i = 0; i < nProcs; i++ )
+            ABC_FREE( ThData[i].pSol );
+        nGates += nProcs;
+    }
+
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Ses_Man_t * p = ThData[i].pSes;
+        pSes->timeSat      += p->timeSat;
+        pSes->timeSatSat   += p->timeSatSat;
+        pSes->timeSatUnsat += p->timeSatUnsat;
+        pSes->timeSatUndef += p->timeSatUndef;
+        pSes->timeInstance += p->timeInstance;
+        pSes->nSatCalls    += p->nSatCalls;
+        pSes->nUnsatCalls  += p->nUnsatCalls;
+        pSes->nUndefCalls  += p->nUndefCalls;
+        p->bSpecInv = 0;
+        Ses_ManClean( p );
+    }
+    return pSol;
+}
+
 static char * Ses_ManFindMinimumSize( Ses_Man_t * pSes )
 {
     char * pSol = NULL;
@@ -2389,6 +2536,9 @@ static char * Ses_ManFindMinimumSize( Ses_Man_t * pSes )
         Ses_ManComputeMaxGates( pSes );
     }
 
+    if ( pSes->nProcs > 1 && pSes->nMaxDepth == -1 )
+        return Ses_ManFindMinimumSizeParallel( pSes );
+
     pSol = Ses_ManFindMinimumSizeBottomUp( pSes );
 
     if ( !pSol && pSes->nMaxDepth != -1 && pSes->fHitResLimit && pSes->nGates != pSes->nMaxGates )
@@ -2412,6 +2562,10 @@ static char * Ses_ManFindMinimumSize( Ses_Man_t * pSes )
 
 ***********************************************************************/
 Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+{
+    return Abc_NtkFindExactMt( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, nBTLimit, nStartGates, 1, fVerbose );
+}
+Abc_Ntk_t * Abc_NtkFindExactMt( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nProcs, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2425,6 +2579,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 0, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nProcs = nProcs;
     pSes->fReasonVerbose = 0;
     pSes->fSatVerbose = 0;
     if ( fVerbose )
@@ -2447,7 +2602,7 @@ Abc_Ntk_t * Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
     return pNtk;
 }
 
-Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+Gia_Man_t * Gia_ManFindExactMt( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int nProcs, int fVerbose )
 {
     Ses_Man_t * pSes;
     char * pSol;
@@ -2461,6 +2616,7 @@ Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     pSes = Ses_ManAlloc( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, 1, nBTLimit, fVerbose );
     pSes->nStartGates = nStartGates;
+    pSes->nProcs = nProcs;
     pSes->fVeryVerbose = 1;
     pSes->fExtractVerbose = 0;
     pSes->fSatVerbose = 0;
@@ -2484,6 +2640,10 @@ Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth
 
     return pGia;
 }
+Gia_Man_t * Gia_ManFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrTimeProfile, int nBTLimit, int nStartGates, int fVerbose )
+{
+    return Gia_ManFindExactMt( pTruth, nVars, nFunc, nMaxDepth, pArrTimeProfile, nBTLimit, nStartGates, 1, fVerbose );
+}
 
 /**Function*************************************************************
 
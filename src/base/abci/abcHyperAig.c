@@ -361,7 +361,7 @@ int Aig_ApplyPartitionResult( void * pNtk, Aig_Hyper_t * pHyper, Vec_Int_t * vPa
 {
     Abc_Ntk_t * pAig = (Abc_Ntk_t *)pNtk;
     Abc_Obj_t * pObj, * pFanin, * pFanout;
-    int i, j, nodeIdx, partId, faninPart, fanoutPart;
+    int i, j, nodeIdx, partId, faninPart;
     Vec_Vec_t * vPartNodes;      // Nodes in each partition
     Vec_Vec_t * vPartInputs;     // Input nodes for each partition  
     Vec_Vec_t * vPartOutputs;    // Output nodes for each partition
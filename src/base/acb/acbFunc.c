@@ -2602,14 +2602,14 @@ Gia_Man_t * Acb_NtkEcoSynthesize( Gia_Man_t * p )
     }
     return pNew;
 }
-Cnf_Dat_t * Acb_NtkDeriveMiterCnf( Gia_Man_t * p, int iTar, int nTars, int fVerbose )
+Gia_Man_t * Acb_NtkDeriveMiterQuant( Gia_Man_t * p, int iStart, int iTar, int nTars )
 {
-    Gia_Man_t * pCof = Gia_ManDup( p );
-    Cnf_Dat_t * pCnf; int v;
-    for ( v = 0; v < iTar; v++ )
+    // universally quantifies targets iStart..iTar-1
+    Gia_Man_t * pCof = Gia_ManDup( p ), * pTemp; int v;
+    for ( v = iStart; v < iTar; v++ )
     {
-        Gia_Man_t * pTemp;
-        pCof = Gia_ManDupUniv( p = pCof, Gia_ManCiNum(pCof) - nTars + v );
+        pCof = Gia_ManDupUniv( pTemp = pCof, Gia_ManCiNum(pCof) - nTars + v );
+        Gia_ManStop( pTemp );
         //pCof = Acb_NtkEcoSynthesize( pTemp = pCof );
         //pCof = Gia_ManCompress2( pTemp = pCof, 1, 0 );
         pCof = Gia_ManAigSyn2( pTemp = pCof, 0, 1, 0, 100, 0, 0, 0 );
@@ -2620,8 +2620,13 @@ Cnf_Dat_t * Acb_NtkDeriveMiterCnf( Gia_Man_t * p, int iTar, int nTars, int fVerb
             Gia_ManPrintStats( pCof, NULL );
         }
         assert( Gia_ManCiNum(pCof) == Gia_ManCiNum(p) );
-        Gia_ManStop( p );
     }
+    return pCof;
+}
+Cnf_Dat_t * Acb_NtkDeriveMiterCnf( Gia_Man_t * p, int iStart, int iTar, int nTars, int fVerbose )
+{
+    Gia_Man_t * pCof = Acb_NtkDeriveMiterQuant( p, iStart, iTar, nTars );
+    Cnf_Dat_t * pCnf;
     if ( fVerbose ) printf( "M_quo: " );
     if ( fVerbose ) Gia_ManPrintStats( pCof, NULL );
     //pCof = Acb_NtkEcoSynthesize( p = pCof );
@@ -2649,6 +2654,52 @@ Cnf_Dat_t * Acb_NtkDeriveMiterCnf( Gia_Man_t * p, int iTar, int nTars, int fVerb
     Gia_ManStop( pCof );
     return pCnf;
 }
+int Acb_NtkMiterQuantStep( int nTars )
+{
+    // checkpoints are kept after every nStep targets, where nStep is about sqrt(nTars)
+    int nStep = 1;
+    while ( nStep * nStep < nTars )
+        nStep++;
+    return nStep;
+}
+Vec_Ptr_t * Acb_NtkDeriveMiterQuants( Gia_Man_t * p, int nTars )
+{
+    // entry k (k > 0) is the miter with targets 0..k*nStep-1 quantified; entry 0 is the miter itself
+    int k, nStep = Acb_NtkMiterQuantStep( nTars );
+    Vec_Ptr_t * vQuants = Vec_PtrAlloc( nTars / nStep + 1 );
+    Gia_Man_t * pCof = p;
+    Vec_PtrPush( vQuants, NULL );
+    for ( k = nStep; k < nTars; k += nStep )
+        Vec_PtrPush( vQuants, (pCof = Acb_NtkDeriveMiterQuant(pCof, k - nStep, k, nTars)) );
+    return vQuants;
+}
+Cnf_Dat_t * Acb_NtkDeriveMiterCnfQuant( Gia_Man_t * p, Vec_Ptr_t * vQuants, int iTar, int nTars, int fVerbose )
+{
+    // quantifies the targets below iTar starting from the closest checkpoint
+    int nStep = Acb_NtkMiterQuantStep( nTars );
+    int iBase = iTar / nStep;
+    Gia_Man_t * pBase = iBase ? (Gia_Man_t *)Vec_PtrEntry( vQuants, iBase ) : p;
+    Cnf_Dat_t * pCnf = Acb_NtkDeriveMiterCnf( pBase, iBase * nStep, iTar, nTars, fVerbose );
+    // the checkpoint is not needed for the remaining targets
+    if ( iBase && iTar == iBase * nStep )
+    {
+        Gia_ManStop( pBase );
+        Vec_PtrWriteEntry( vQuants, iBase, NULL );
+    }
+    return pCnf;
+}
+void Acb_NtkUpdateMiterQuants( Vec_Ptr_t * vQuants, Gia_Man_t * pOne, int iTar, int nTars, Vec_Int_t * vUsed )
+{
+    // substitute the patch of target iTar into the checkpoints of the remaining targets
+    Gia_Man_t * pTemp; int k;
+    Vec_PtrForEachEntryStart( Gia_Man_t *, vQuants, pTemp, k, 1 )
+    {
+        if ( pTemp == NULL )
+            continue;
+        Vec_PtrWriteEntry( vQuants, k, Acb_UpdateMiter(pTemp, pOne, iTar, nTars, vUsed, 0) );
+        Gia_ManStop( pTemp );
+    }
+}
 Gia_Man_t * Gia_ManInterOneInt( Gia_Man_t * pCof1, Gia_Man_t * pCof0, int Depth )
 {
     extern Gia_Man_t * Gia_ManInterOne( Gia_Man_t * pNtkOn, Gia_Man_t * pNtkOff, int fVerbose );
@@ -2901,6 +2952,7 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
     Vec_Ptr_t * vSops    = Vec_PtrAlloc( nTargets );
     Vec_Wec_t * vSupps   = Vec_WecAlloc( nTargets );
     Vec_Int_t * vSuppOld = Vec_IntAlloc( 100 );
+    Vec_Ptr_t * vQuants  = NULL;
 
     Vec_Int_t * vUsed  = NULL; 
     Vec_Ptr_t * vFuncs = NULL;
@@ -2931,7 +2983,7 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
     {
         int Lit, status;
         sat_solver * pSat;
-        pCnf = Acb_NtkDeriveMiterCnf( pGiaM, nTargets, nTargets, fVerbose );
+        pCnf = Acb_NtkDeriveMiterCnf( pGiaM, 0, nTargets, nTargets, fVerbose );
         pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
         Cnf_DataFree( pCnf );
         // add output clause
@@ -2948,6 +3000,10 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
         }
     }
 
+    // quantify the targets once at the checkpoints; patches are substituted into them later
+    if ( !fCisOnly )
+        vQuants = Acb_NtkDeriveMiterQuants( pGiaM, nTargets );
+
     for ( i = nTargets-1; i >= 0; i-- )
     {
         Vec_Int_t * vSupp = NULL;
@@ -2971,7 +3027,7 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
         }
         else
         {
-            pCnf = Acb_NtkDeriveMiterCnf( pGiaM, i, nTargets, fVerbose );
+            pCnf = Acb_NtkDeriveMiterCnfQuant( pGiaM, vQuants, i, nTargets, fVerbose );
 //            vSupp = Acb_DerivePatchSupportS( pCnf, i, nTargets, Vec_IntSize(vDivs), vDivs, pNtkF, NULL, TimeOut );
             vSupp = Acb_DerivePatchSupport( pCnf, i, nTargets, Vec_IntSize(vDivs), vDivs, pNtkF, vSuppOld, TimeOut );
             if ( vSupp == NULL )
@@ -3010,6 +3066,7 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
             // update miter
             pGiaM = Acb_UpdateMiter( pTemp = pGiaM, pOne, i, nTargets, vSupp, fCisOnly );
             Gia_ManStop( pTemp );
+            Acb_NtkUpdateMiterQuants( vQuants, pOne, i, nTargets, vSupp );
             Gia_ManStop( pOne );
 
             // add to functions
@@ -3082,6 +3139,14 @@ cleanup:
             Gia_ManStop( pTemp );
         Vec_PtrFree( vGias );
     }
+    if ( vQuants )
+    {
+        Gia_Man_t * pTemp; int i;
+        Vec_PtrForEachEntry( Gia_Man_t *, vQuants, pTemp, i )
+            if ( pTemp )
+                Gia_ManStop( pTemp );
+        Vec_PtrFree( vQuants );
+    }
     Vec_StrFreeP( &vPatch );
     Vec_StrFreeP( &vInst );
 
@@ -159,6 +159,7 @@ void Cmd_End( Abc_Frame_t * pAbc )
     st__free_table( pAbc->tFlags );
 
     Vec_PtrFreeFree( pAbc->aHistory );
+    Cmd_ProfClear( pAbc );
 }
 
 
@@ -176,18 +177,33 @@ void Cmd_End( Abc_Frame_t * pAbc )
 ******************************************************************************/
 int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
 {
+    char * pFileName = NULL;
     int c;
     int fClear;
+    int fMemory;
 
     fClear = 0;
+    fMemory = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ch" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "jcmh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'j':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( pAbc->Err, "Command line switch \"-j\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'c':
             fClear ^= 1;
             break;
+        case 'm':
+            fMemory ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -195,10 +211,17 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
         }
     }
 
+    if ( fMemory )
+        Cmd_ProfPrint( pAbc );
+    if ( pFileName && !Cmd_ProfDump( pAbc, pFileName ) )
+        return 1;
+
     if ( fClear )
     {
         pAbc->TimeTotal += pAbc->TimeCommand;
         pAbc->TimeCommand = 0.0;
+        if ( fMemory || pFileName )
+            Cmd_ProfClear( pAbc );
         return 0;
     }
 
@@ -207,6 +230,8 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
         goto usage;
     }
 
+    if ( fMemory || pFileName )
+        return 0;
 
     pAbc->TimeTotal += pAbc->TimeCommand;
     fprintf( pAbc->Out, "elapse: %3.2f seconds, total: %3.2f seconds\n",
@@ -223,9 +248,11 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
   usage:
-    fprintf( pAbc->Err, "usage: time [-ch]\n" );
+    fprintf( pAbc->Err, "usage: time [-cmh] [-j file]\n" );
     fprintf( pAbc->Err, "      \t\tprint the runtime since the last call\n" );
-    fprintf( pAbc->Err, "   -c \t\tclears the elapsed time without printing it\n" );
+    fprintf( pAbc->Err, "   -c \t\tclears the elapsed time (and the memory profile) without printing it\n" );
+    fprintf( pAbc->Err, "   -m \t\tprints the peak memory and allocations of each command\n" );
+    fprintf( pAbc->Err, "   -j \t\tdumps the memory profile of the commands into a JSON file\n" );
     fprintf( pAbc->Err, "   -h \t\tprint the command usage\n" );
     return 1;
 }
@@ -66,6 +66,13 @@ extern void        Cmd_HistoryWrite( Abc_Frame_t * p, int Limit );
 extern void        Cmd_HistoryPrint( Abc_Frame_t * p, int Limit );
 /*=== cmdLoad.c ========================================================*/
 extern int         CmdCommandLoad( Abc_Frame_t * pAbc, int argc, char ** argv );
+/*=== cmdProf.c ========================================================*/
+extern void        Cmd_ProfStart( Abc_Frame_t * pAbc );
+extern void        Cmd_ProfStop( Abc_Frame_t * pAbc, int argc, char ** argv, double Time );
+extern void        Cmd_ProfClear( Abc_Frame_t * pAbc );
+extern void        Cmd_ProfPrint( Abc_Frame_t * pAbc );
+extern void        Cmd_ProfPrintUsage( Abc_Frame_t * pAbc );
+extern int         Cmd_ProfDump( Abc_Frame_t * pAbc, char * pFileName );
 
 
 
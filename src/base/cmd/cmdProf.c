@@ -0,0 +1,372 @@
+/**CFile****************************************************************
+
+  FileName    [cmdProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Memory profile of the commands.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "cmd.h"
+#include "cmdInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CMD_PROF_DEPTH  64       // the max nesting of the profiled commands
+#define CMD_PROF_STEPS  100000   // the max number of steps recorded
+
+typedef struct Cmd_Prof_t_ Cmd_Prof_t;
+struct Cmd_Prof_t_
+{
+    char *           pName;      // the command name (or the command line for a step)
+    int              nCalls;     // the number of calls
+    int              Depth;      // the nesting depth of the step
+    double           Time;       // the total runtime
+    iword            nBytes;     // the number of bytes allocated on the heap
+    iword            nAllocs;    // the number of heap allocations
+    iword            nHeapPeak;  // the max growth of the heap in use over the start of the command
+    iword            nPoolPeak;  // the max growth of the pool memory over the start of the command
+    iword            nRssGrowth; // the total growth of the peak RSS
+    iword            nRssPeak;   // the peak RSS after the command
+};
+
+typedef struct Cmd_ProfStart_t_ Cmd_ProfStart_t;
+struct Cmd_ProfStart_t_
+{
+    iword            nHeapLive;  // the heap in use at the start
+    iword            nHeapPeak;  // the heap peak before the start
+    iword            nPoolLive;  // the pool memory at the start
+    iword            nPoolPeak;  // the pool peak before the start
+    iword            nBytes;     // the heap bytes allocated before the start
+    iword            nAllocs;    // the heap allocations before the start
+    iword            nRss;       // the peak RSS at the start
+};
+
+static Cmd_ProfStart_t s_CmdProfStack[CMD_PROF_DEPTH];
+static int             s_nCmdProfDepth = 0;
+
+static inline iword    Cmd_ProfMax( iword a, iword b ) { return a > b ? a : b; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Remembers the memory usage before the command.]
+
+  Description [The commands can be nested (for example, when executing
+  "source" or "autoexec"), in which case the outer command is charged
+  with the memory of the inner ones.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_ProfStart( Abc_Frame_t * pAbc )
+{
+    Cmd_ProfStart_t * p;
+    if ( s_nCmdProfDepth++ >= CMD_PROF_DEPTH )
+        return;
+    p = s_CmdProfStack + s_nCmdProfDepth - 1;
+    Abc_MemProfRead( ABC_MEM_PROF_HEAP, &p->nHeapLive, NULL, &p->nBytes, &p->nAllocs );
+    Abc_MemProfRead( ABC_MEM_PROF_POOLS, &p->nPoolLive, NULL, NULL, NULL );
+    p->nHeapPeak = Abc_MemProfPeakReset( ABC_MEM_PROF_HEAP );
+    p->nPoolPeak = Abc_MemProfPeakReset( ABC_MEM_PROF_POOLS );
+    p->nRss      = Abc_MemProfPeakRss();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Charges the command with the memory used.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cmd_Prof_t * Cmd_ProfFind( Vec_Ptr_t * vProfs, char * pName )
+{
+    Cmd_Prof_t * pProf;
+    int i;
+    Vec_PtrForEachEntry( Cmd_Prof_t *, vProfs, pProf, i )
+        if ( !strcmp(pProf->pName, pName) )
+            return pProf;
+    pProf = ABC_CALLOC( Cmd_Prof_t, 1 );
+    pProf->pName = Abc_UtilStrsav( pName );
+    Vec_PtrPush( vProfs, pProf );
+    return pProf;
+}
+static void Cmd_ProfAdd( Cmd_Prof_t * pProf, Cmd_Prof_t * pThis )
+{
+    pProf->nCalls++;
+    pProf->Time       += pThis->Time;
+    pProf->nBytes     += pThis->nBytes;
+    pProf->nAllocs    += pThis->nAllocs;
+    pProf->nHeapPeak   = Cmd_ProfMax( pProf->nHeapPeak, pThis->nHeapPeak );
+    pProf->nPoolPeak   = Cmd_ProfMax( pProf->nPoolPeak, pThis->nPoolPeak );
+    pProf->nRssGrowth += pThis->nRssGrowth;
+    pProf->nRssPeak    = Cmd_ProfMax( pProf->nRssPeak, pThis->nRssPeak );
+}
+void Cmd_ProfStop( Abc_Frame_t * pAbc, int argc, char ** argv, double Time )
+{
+    Cmd_ProfStart_t * p;
+    Cmd_Prof_t This, * pStep;
+    iword nHeapPeak, nPoolPeak, nBytes, nAllocs;
+    int i;
+    assert( s_nCmdProfDepth > 0 );
+    if ( --s_nCmdProfDepth >= CMD_PROF_DEPTH || argc == 0 )
+        return;
+    p = s_CmdProfStack + s_nCmdProfDepth;
+    Abc_MemProfRead( ABC_MEM_PROF_HEAP, NULL, &nHeapPeak, &nBytes, &nAllocs );
+    Abc_MemProfRead( ABC_MEM_PROF_POOLS, NULL, &nPoolPeak, NULL, NULL );
+    memset( &This, 0, sizeof(Cmd_Prof_t) );
+    This.Depth      = s_nCmdProfDepth;
+    This.Time       = Time;
+    This.nBytes     = nBytes - p->nBytes;
+    This.nAllocs    = nAllocs - p->nAllocs;
+    This.nHeapPeak  = Cmd_ProfMax( nHeapPeak - p->nHeapLive, 0 );
+    This.nPoolPeak  = Cmd_ProfMax( nPoolPeak - p->nPoolLive, 0 );
+    This.nRssPeak   = Abc_MemProfPeakRss();
+    This.nRssGrowth = This.nRssPeak - p->nRss;
+    // restore the peaks of the outer commands
+    Abc_MemProfPeakRestore( ABC_MEM_PROF_HEAP, p->nHeapPeak );
+    Abc_MemProfPeakRestore( ABC_MEM_PROF_POOLS, p->nPoolPeak );
+    // charge the command
+    if ( pAbc->vCmdProfs == NULL )
+        pAbc->vCmdProfs = Vec_PtrAlloc( 100 );
+    Cmd_ProfAdd( Cmd_ProfFind(pAbc->vCmdProfs, argv[0]), &This );
+    // record the step
+    if ( pAbc->vCmdSteps == NULL )
+        pAbc->vCmdSteps = Vec_PtrAlloc( 100 );
+    if ( Vec_PtrSize(pAbc->vCmdSteps) >= CMD_PROF_STEPS )
+        return;
+    pStep = ABC_CALLOC( Cmd_Prof_t, 1 );
+    *pStep = This;
+    pStep->nCalls = 1;
+    pStep->pName = Abc_UtilStrsav( argv[0] );
+    for ( i = 1; i < argc; i++ )
+    {
+        char * pTemp = pStep->pName;
+        pStep->pName = ABC_ALLOC( char, strlen(pTemp) + strlen(argv[i]) + 2 );
+        sprintf( pStep->pName, "%s %s", pTemp, argv[i] );
+        ABC_FREE( pTemp );
+    }
+    Vec_PtrPush( pAbc->vCmdSteps, pStep );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Clears the memory profile.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfFreeVec( Vec_Ptr_t ** pvProfs )
+{
+    Cmd_Prof_t * pProf;
+    int i;
+    if ( *pvProfs == NULL )
+        return;
+    Vec_PtrForEachEntry( Cmd_Prof_t *, *pvProfs, pProf, i )
+    {
+        ABC_FREE( pProf->pName );
+        ABC_FREE( pProf );
+    }
+    Vec_PtrFreeP( pvProfs );
+}
+void Cmd_ProfClear( Abc_Frame_t * pAbc )
+{
+    Cmd_ProfFreeVec( &pAbc->vCmdProfs );
+    Cmd_ProfFreeVec( &pAbc->vCmdSteps );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the memory profile of the commands.]
+
+  Description [The commands are sorted by the growth of the peak RSS,
+  so that the commands responsible for the peak come first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_ProfCompare( Cmd_Prof_t ** pp1, Cmd_Prof_t ** pp2 )
+{
+    if ( (*pp1)->nRssGrowth != (*pp2)->nRssGrowth )
+        return (*pp1)->nRssGrowth > (*pp2)->nRssGrowth ? -1 : 1;
+    if ( (*pp1)->nHeapPeak != (*pp2)->nHeapPeak )
+        return (*pp1)->nHeapPeak > (*pp2)->nHeapPeak ? -1 : 1;
+    return strcmp( (*pp1)->pName, (*pp2)->pName );
+}
+void Cmd_ProfPrint( Abc_Frame_t * pAbc )
+{
+    Vec_Ptr_t * vProfs;
+    Cmd_Prof_t * pProf;
+    int i, fHeap = Abc_MemProfIsHeap();
+    if ( pAbc->vCmdProfs == NULL || Vec_PtrSize(pAbc->vCmdProfs) == 0 )
+    {
+        fprintf( pAbc->Out, "The memory profile is empty.\n" );
+        return;
+    }
+    vProfs = Vec_PtrDup( pAbc->vCmdProfs );
+    Vec_PtrSort( vProfs, (int (*)(const void *, const void *))Cmd_ProfCompare );
+    fprintf( pAbc->Out, "%-20s %6s %10s %10s %10s %10s %10s %10s %10s\n",
+        "Command", "Calls", "Time, s", "Allocs", "Alloc, MB", "Heap, MB", "Pools, MB", "+RSS, MB", "RSS, MB" );
+    Vec_PtrForEachEntry( Cmd_Prof_t *, vProfs, pProf, i )
+    {
+        fprintf( pAbc->Out, "%-20s %6d %10.2f ", pProf->pName, pProf->nCalls, pProf->Time );
+        if ( fHeap )
+            fprintf( pAbc->Out, "%10.0f %10.2f %10.2f ", (double)pProf->nAllocs,
+                1.0*pProf->nBytes/(1<<20), 1.0*pProf->nHeapPeak/(1<<20) );
+        else
+            fprintf( pAbc->Out, "%10s %10s %10s ", "-", "-", "-" );
+        fprintf( pAbc->Out, "%10.2f %10.2f %10.2f\n", 1.0*pProf->nPoolPeak/(1<<20),
+            1.0*pProf->nRssGrowth/(1<<20), 1.0*pProf->nRssPeak/(1<<20) );
+    }
+    Vec_PtrFree( vProfs );
+    if ( !fHeap )
+        fprintf( pAbc->Out, "The heap is not profiled (compile with ABC_USE_MEM_PROFILE=1).\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the current memory usage.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_ProfPrintUsage( Abc_Frame_t * pAbc )
+{
+    iword nLive, nPeak;
+    fprintf( pAbc->Out, "Memory: Peak RSS = %.2f MB.", 1.0*Abc_MemProfPeakRss()/(1<<20) );
+    Abc_MemProfRead( ABC_MEM_PROF_POOLS, &nLive, NULL, NULL, NULL );
+    nPeak = Abc_MemProfPeakTotal( ABC_MEM_PROF_POOLS );
+    fprintf( pAbc->Out, "  Pools = %.2f MB (peak %.2f MB).", 1.0*nLive/(1<<20), 1.0*nPeak/(1<<20) );
+    if ( Abc_MemProfIsHeap() )
+    {
+        Abc_MemProfRead( ABC_MEM_PROF_HEAP, &nLive, NULL, NULL, NULL );
+        nPeak = Abc_MemProfPeakTotal( ABC_MEM_PROF_HEAP );
+        fprintf( pAbc->Out, "  Heap = %.2f MB (peak %.2f MB).", 1.0*nLive/(1<<20), 1.0*nPeak/(1<<20) );
+    }
+    fprintf( pAbc->Out, "\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dumps the memory profile into a JSON file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ProfDumpString( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+static void Cmd_ProfDumpCounters( FILE * pFile, char * pName, int iKind, int fLast )
+{
+    iword nLive, nPeak, nBytes, nAllocs;
+    Abc_MemProfRead( iKind, &nLive, NULL, &nBytes, &nAllocs );
+    nPeak = Abc_MemProfPeakTotal( iKind );
+    fprintf( pFile, "    \"%s\": { \"live\": %.0f, \"peak\": %.0f, \"bytes\": %.0f, \"allocs\": %.0f }%s\n",
+        pName, (double)nLive, (double)nPeak, (double)nBytes, (double)nAllocs, fLast ? "" : "," );
+}
+static void Cmd_ProfDumpVec( FILE * pFile, Vec_Ptr_t * vProfs, int fSteps )
+{
+    Cmd_Prof_t * pProf;
+    int i;
+    if ( vProfs == NULL )
+        return;
+    Vec_PtrForEachEntry( Cmd_Prof_t *, vProfs, pProf, i )
+    {
+        fprintf( pFile, "    { \"%s\": ", fSteps ? "command" : "name" );
+        Cmd_ProfDumpString( pFile, pProf->pName );
+        if ( fSteps )
+            fprintf( pFile, ", \"depth\": %d", pProf->Depth );
+        else
+            fprintf( pFile, ", \"calls\": %d", pProf->nCalls );
+        fprintf( pFile, ", \"time\": %.3f, \"bytes\": %.0f, \"allocs\": %.0f, \"heap_peak\": %.0f, \"pool_peak\": %.0f, \"rss_growth\": %.0f, \"rss_peak\": %.0f }%s\n",
+            pProf->Time, (double)pProf->nBytes, (double)pProf->nAllocs, (double)pProf->nHeapPeak, (double)pProf->nPoolPeak,
+            (double)pProf->nRssGrowth, (double)pProf->nRssPeak, i == Vec_PtrSize(vProfs) - 1 ? "" : "," );
+    }
+}
+int Cmd_ProfDump( Abc_Frame_t * pAbc, char * pFileName )
+{
+    FILE * pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        fprintf( pAbc->Err, "Cannot open file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    fprintf( pFile, "{\n" );
+    fprintf( pFile, "  \"heap_profiled\": %s,\n", Abc_MemProfIsHeap() ? "true" : "false" );
+    fprintf( pFile, "  \"peak_rss\": %.0f,\n", (double)Abc_MemProfPeakRss() );
+    fprintf( pFile, "  \"memory\": {\n" );
+    Cmd_ProfDumpCounters( pFile, "heap",  ABC_MEM_PROF_HEAP,  0 );
+    Cmd_ProfDumpCounters( pFile, "fixed", ABC_MEM_PROF_FIXED, 0 );
+    Cmd_ProfDumpCounters( pFile, "flex",  ABC_MEM_PROF_FLEX,  0 );
+    Cmd_ProfDumpCounters( pFile, "step",  ABC_MEM_PROF_STEP,  0 );
+    Cmd_ProfDumpCounters( pFile, "pools", ABC_MEM_PROF_POOLS, 1 );
+    fprintf( pFile, "  },\n" );
+    fprintf( pFile, "  \"commands\": [\n" );
+    Cmd_ProfDumpVec( pFile, pAbc->vCmdProfs, 0 );
+    fprintf( pFile, "  ],\n" );
+    fprintf( pFile, "  \"steps\": [\n" );
+    Cmd_ProfDumpVec( pFile, pAbc->vCmdSteps, 1 );
+    fprintf( pFile, "  ]\n" );
+    fprintf( pFile, "}\n" );
+    fclose( pFile );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
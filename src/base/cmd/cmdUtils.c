@@ -154,7 +154,9 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     // execute the command
     clk = Extra_CpuTimeDouble();
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
+    Cmd_ProfStart( pAbc );
     fError = (*pFunc)( pAbc, argc, argv );
+    Cmd_ProfStop( pAbc, argc, argv, Extra_CpuTimeDouble() - clk );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
 
     // automatic execution of arbitrary command after each command 
@@ -88,6 +88,7 @@ extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
+extern Abc_Ntk_t *        Io_ReadBlifMvProcs( char * pFileName, int fBlifMv, int fCheck, int nProcs );
 /*=== abcReadBench.c ==========================================================*/
 extern Abc_Ntk_t *        Io_ReadBench( char * pFileName, int fCheck );
 extern void               Io_ReadBenchInit( Abc_Ntk_t * pNtk, char * pFileName );
@@ -99,6 +100,7 @@ extern Abc_Ntk_t *        Io_ReadEqn( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadPla( char * pFileName, int fZeros, int fBoth, int fOnDc, int fSkipPrepro, int fCheck );
 /*=== abcReadVerilog.c ========================================================*/
 extern Abc_Ntk_t *        Io_ReadVerilog( char * pFileName, int fCheck );
+extern Abc_Ntk_t *        Io_ReadVerilogProcs( char * pFileName, int fCheck, int nProcs );
 /*=== abcWriteAiger.c =========================================================*/
 extern void               Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int fCompact, int fUnique );
 extern void               Io_WriteAigerCex( Abc_Cex_t * pCex, Abc_Ntk_t * pNtk, void * pG, char * pFileName );
@@ -145,7 +147,9 @@ extern void               Io_WriteVerilog( Abc_Ntk_t * pNtk, char * FileName, in
 extern Io_FileType_t      Io_ReadFileType( char * pFileName );
 extern Io_FileType_t      Io_ReadLibType( char * pFileName );
 extern Abc_Ntk_t *        Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck );
+extern Abc_Ntk_t *        Io_ReadNetlistProcs( char * pFileName, Io_FileType_t FileType, int fCheck, int nProcs );
 extern Abc_Ntk_t *        Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs );
+extern Abc_Ntk_t *        Io_ReadProcs( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs, int nProcs );
 extern void               Io_Write( Abc_Ntk_t * pNtk, char * pFileName, Io_FileType_t FileType );
 extern void               Io_WriteHie( Abc_Ntk_t * pNtk, char * pBaseName, char * pFileName );
 extern Abc_Obj_t *        Io_ReadCreatePi( Abc_Ntk_t * pNtk, char * pName );
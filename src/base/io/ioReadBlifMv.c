@@ -36,6 +36,28 @@ ABC_NAMESPACE_IMPL_START
 typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
 typedef struct Io_MvMod_t_ Io_MvMod_t; // parsing model
 typedef struct Io_MvMan_t_ Io_MvMan_t; // parsing manager
+typedef struct Io_MvChunk_t_ Io_MvChunk_t; // parsing chunk
+
+// directives collected while preparsing
+typedef enum { 
+    IO_MV_NAMES,                       // .names/.table/.gate
+    IO_MV_LTL,                         // .ltlformula
+    IO_MV_LATCH,                       // .latch
+    IO_MV_FLOP,                        // .flop
+    IO_MV_RESET,                       // .reset
+    IO_MV_INPUTS,                      // .inputs
+    IO_MV_OUTPUTS,                     // .outputs
+    IO_MV_SUBCKT,                      // .subckt
+    IO_MV_SHORT,                       // .short
+    IO_MV_ONEHOT,                      // .onehot
+    IO_MV_MV,                          // .mv
+    IO_MV_CONSTR,                      // .constraint
+    IO_MV_BLACKBOX,                    // .blackbox
+    IO_MV_MODEL,                       // .model
+    IO_MV_END,                         // .end
+    IO_MV_EXDC,                        // .exdc
+    IO_MV_SKIP                         // unknown directive
+} Io_MvDir_t;
 
 Vec_Ptr_t *vGlobalLtlArray;
 
@@ -61,6 +83,7 @@ struct Io_MvMod_t_
     Vec_Ptr_t *          vMvs;         // .mv lines
     Vec_Ptr_t *          vConstrs;     // .constraint lines
     Vec_Ptr_t *             vLtlProperties;
+    Vec_Wrd_t *          vNameToks;    // tokens of .names lines found while preparsing (or NULL)
     int                  fBlackBox;    // indicates blackbox model
     // the resulting network
     Abc_Ntk_t *          pNtk;   
@@ -77,6 +100,8 @@ struct Io_MvMan_t_
     char *               pFileName;    // the name of the file
     char *               pBuffer;      // the contents of the file
     Vec_Ptr_t *          vLines;       // the line beginnings
+    int                  nProcs;       // the number of threads used to preparse
+    Vec_Ptr_t *          vChunks;      // the chunks of the file preparsed independently
     // the results of reading
     Abc_Des_t *          pDesign;      // the design under construction
     int                  nNDnodes;     // the counter of ND nodes
@@ -94,6 +119,20 @@ struct Io_MvMan_t_
     int                  nTablesLeft;  // the number of dangling tables
 };
 
+struct Io_MvChunk_t_
+{
+    Io_MvMan_t *         pMan;         // the parent manager
+    char *               pBeg;         // the first character of the chunk
+    char *               pEnd;         // the character following the chunk
+    int                  fLast;        // the chunk ends the buffer
+    Vec_Ptr_t *          vLines;       // the line beginnings
+    Vec_Ptr_t *          vDirs;        // the directive lines
+    Vec_Int_t *          vTypes;       // the directive types
+    Vec_Int_t *          vToks;        // the token offsets of .names lines (or NULL)
+};
+
+// the number of threads used to preparse the file
+
 // static functions
 static Io_MvMan_t *      Io_MvAlloc();
 static void              Io_MvFree( Io_MvMan_t * p );
@@ -113,7 +152,7 @@ static int               Io_MvParseLineSubckt( Io_MvMod_t * p, char * pLine );
 static Vec_Int_t *       Io_MvParseLineOnehot( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineMv( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset );
-static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine );
+static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine, int iLine );
 static int               Io_MvParseLineShortBlif( Io_MvMod_t * p, char * pLine );
 static int                 Io_MvParseLineLtlProperty( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens );
@@ -140,6 +179,25 @@ extern void              Abc_NtkStartMvVars( Abc_Ntk_t * pNtk );
 
 ***********************************************************************/
 Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
+{
+    return Io_ReadBlifMvProcs( pFileName, fBlifMv, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the network from the BLIF or BLIF-MV file.]
+
+  Description [With more than one thread, the file is split into chunks 
+  at directive lines, which are broken into lines and tokens concurrently; 
+  the network is then built from the tokens of the chunks in the order 
+  they appear in the file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifMvProcs( char * pFileName, int fBlifMv, int fCheck, int nProcs )
 {
     FILE * pFile;
     Io_MvMan_t * p;
@@ -162,6 +220,7 @@ Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
     p = Io_MvAlloc();
     p->fBlifMv   = fBlifMv;
     p->fUseReset = 1;
+    p->nProcs    = Abc_MaxInt( nProcs, 1 );
     p->pFileName = pFileName;
     p->pBuffer   = Io_MvLoadFile( pFileName );
     if ( p->pBuffer == NULL )
@@ -300,6 +359,19 @@ static void Io_MvFree( Io_MvMan_t * p )
         ABC_FREE( p->pBuffer );
     if ( p->vLines )
         Vec_PtrFree( p->vLines  );
+    if ( p->vChunks )
+    {
+        Io_MvChunk_t * pChunk;
+        Vec_PtrForEachEntry( Io_MvChunk_t *, p->vChunks, pChunk, i )
+        {
+            Vec_PtrFree( pChunk->vLines );
+            Vec_PtrFree( pChunk->vDirs );
+            Vec_IntFree( pChunk->vTypes );
+            Vec_IntFreeP( &pChunk->vToks );
+            ABC_FREE( pChunk );
+        }
+        Vec_PtrFree( p->vChunks );
+    }
     if ( p->vModels )
     {
         Vec_PtrForEachEntry( Io_MvMod_t *, p->vModels, pMod, i )
@@ -370,6 +442,7 @@ static void Io_MvModFree( Io_MvMod_t * p )
     Vec_PtrFree( p->vOnehots );
     Vec_PtrFree( p->vMvs );
     Vec_PtrFree( p->vConstrs );
+    Vec_WrdFreeP( &p->vNameToks );
     ABC_FREE( p );
 }
 
@@ -510,6 +583,29 @@ static void Io_MvSplitIntoTokensAndClear( Vec_Ptr_t * vTokens, char * pLine, cha
     Io_MvCollectTokens( vTokens, pLine, pCur );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the tokens of the .names line found while preparsing.]
+
+  Description [Returns the tokens of the line itself or the tokens of 
+  the table following it in p->pMan->vTokens.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvReadTokens( Io_MvMod_t * p, char * pLine, int iLine, int fTable )
+{
+    word Entry = Vec_WrdEntry( p->vNameToks, iLine );
+    Io_MvChunk_t * pChunk = (Io_MvChunk_t *)Vec_PtrEntry( p->pMan->vChunks, (int)(Entry >> 32) );
+    int * pToks = Vec_IntEntryP( pChunk->vToks, (int)(Entry & 0xFFFFFFFF) );
+    int i, nToks = pToks[fTable], * pOffs = pToks + 2 + (fTable ? pToks[0] : 0);
+    Vec_PtrClear( p->pMan->vTokens );
+    for ( i = 0; i < nToks; i++ )
+        Vec_PtrPush( p->pMan->vTokens, pLine + pOffs[i] );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the 1-based number of the line in which the token occurs.]
@@ -630,23 +726,32 @@ char * Io_MvLoadFileBz2( char * pFileName, long * pnFileSize )
 ***********************************************************************/
 static char * Io_MvLoadFileGz( char * pFileName, long * pnFileSize )
 {
-    const int READ_BLOCK_SIZE = 100000;
+    const int READ_BLOCK_SIZE = (1 << 20);
     gzFile pFile;
     char * pContents;
-    long amtRead, readBlock, nFileSize = READ_BLOCK_SIZE;
+    long amtRead, nFileSize = 0, nFileCap = 8 * READ_BLOCK_SIZE;
     pFile = gzopen( pFileName, "rb" ); // if pFileName doesn't end in ".gz" then this acts as a passthrough to fopen
-    pContents = ABC_ALLOC( char, nFileSize );        
-    readBlock = 0;
-    while ((amtRead = gzread(pFile, pContents + readBlock * READ_BLOCK_SIZE, READ_BLOCK_SIZE)) == READ_BLOCK_SIZE) {
-        //Abc_Print( 1,"%d: read %d bytes\n", readBlock, amtRead);
-        nFileSize += READ_BLOCK_SIZE;
-        pContents = ABC_REALLOC(char, pContents, nFileSize);
-        ++readBlock;
-    }
-    //Abc_Print( 1,"%d: read %d bytes\n", readBlock, amtRead);
+    if ( pFile == NULL )
+    {
+        printf( "Io_MvLoadFileGz(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    // grow the buffer geometrically to keep the total copying linear
+    pContents = ABC_ALLOC( char, nFileCap + 10 );
+    while ( (amtRead = gzread(pFile, pContents + nFileSize, READ_BLOCK_SIZE)) > 0 )
+    {
+        nFileSize += amtRead;
+        if ( nFileSize + READ_BLOCK_SIZE > nFileCap )
+        {
+            nFileCap *= 2;
+            pContents = ABC_REALLOC( char, pContents, nFileCap + 10 );
+        }
+    }
     assert( amtRead != -1 ); // indicates a zlib error
-    nFileSize -= (READ_BLOCK_SIZE - amtRead);
     gzclose(pFile);
+    // finish off the file with the spare .end line
+    // some benchmarks suddenly break off without this line
+    strcpy( pContents + nFileSize, "\n.end\n" );
     *pnFileSize = nFileSize;
     return pContents;
 }
@@ -727,38 +832,140 @@ void Io_MvReplaceBuffersByShorts( char * p )
 
 /**Function*************************************************************
 
-  Synopsis    [Prepares the parsing.]
+  Synopsis    [Returns 1 if the buffer can be split before this newline.]
 
-  Description [Performs several preliminary operations:
-  - Cuts the file buffer into separate lines.
-  - Removes comments and line extenders.
-  - Sorts lines by directives.
-  - Estimates the number of objects.
-  - Allocates room for the objects.
-  - Allocates room for the hash table.]
+  Description [The line following the newline should start a directive
+  and the line preceding it should not end with the line extender, so 
+  that no logical line spans two chunks.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static void Io_MvReadPreparse( Io_MvMan_t * p )
+static int Io_MvChunkCanSplit( char * pBuffer, char * pCur )
 {
+    char * pPrev;
+    if ( pCur[0] != '\n' || pCur[1] != '.' )
+        return 0;
+    for ( pPrev = pCur - 1; pPrev >= pBuffer && *pPrev != '\n'; pPrev-- )
+        if ( !Io_MvCharIsSpace(*pPrev) )
+            break;
+    return pPrev < pBuffer || *pPrev != '\\';
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the buffer into chunks preparsed independently.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvChunkStart( Io_MvMan_t * p )
+{
+    Io_MvChunk_t * pChunk;
+    char * pBeg = p->pBuffer, * pStop = p->pBuffer + strlen(p->pBuffer), * pCur;
+    word nChars = pStop - pBeg, nChunks = 1, i;
+    // use several chunks per thread to balance the load
+    if ( p->nProcs > 1 )
+        nChunks = Abc_MaxWord( 1, Abc_MinWord(4 * p->nProcs, nChars >> 20) );
+    p->vChunks = Vec_PtrAlloc( (int)nChunks );
+    for ( i = 1; pBeg < pStop || i == 1; i++ )
+    {
+        // find the first line starting a directive after the target position
+        pCur = pStop;
+        if ( i < nChunks )
+        {
+            for ( pCur = Abc_MaxWord(nChars * i / nChunks, pBeg - p->pBuffer) + p->pBuffer; pCur < pStop; pCur++ )
+                if ( Io_MvChunkCanSplit(p->pBuffer, pCur) )
+                    break;
+            pCur = pCur < pStop ? pCur + 1 : pStop;
+        }
+        pChunk = ABC_CALLOC( Io_MvChunk_t, 1 );
+        pChunk->pMan   = p;
+        pChunk->pBeg   = pBeg;
+        pChunk->pEnd   = pCur;
+        pChunk->fLast  = (pCur == pStop);
+        pChunk->vLines = Vec_PtrAlloc( 512 );
+        pChunk->vDirs  = Vec_PtrAlloc( 512 );
+        pChunk->vTypes = Vec_IntAlloc( 512 );
+        if ( p->nProcs > 1 && !p->fBlifMv )
+            pChunk->vToks = Vec_IntAlloc( 512 );
+        Vec_PtrPush( p->vChunks, pChunk );
+        pBeg = pCur;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the tokens of one .names line of the chunk.]
+
+  Description [Tokenizes the header of the line and the table following
+  it in the same way as the parser does, and saves the token offsets from 
+  the beginning of the line. The parser then takes the tokens from here.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvChunkTokenize( Io_MvChunk_t * p, char * pLine, Vec_Ptr_t * vTokens, Vec_Ptr_t * vTokens2 )
+{
+    char * pToken, * pName;
+    int i;
+    Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+    Vec_PtrClear( vTokens2 );
+    if ( !strcmp((char *)Vec_PtrEntry(vTokens,0), "names") )
+    {
+        pName = (char *)Vec_PtrEntryLast( vTokens );
+        Io_MvSplitIntoTokens( vTokens2, pName + strlen(pName), '.' );
+    }
+    Vec_IntPush( p->vToks, Vec_PtrSize(vTokens) );
+    Vec_IntPush( p->vToks, Vec_PtrSize(vTokens2) );
+    Vec_PtrForEachEntry( char *, vTokens, pToken, i )
+        Vec_IntPush( p->vToks, (int)(pToken - pLine) );
+    Vec_PtrForEachEntry( char *, vTokens2, pToken, i )
+    {
+        assert( pToken - pLine < 0x7FFFFFFF );
+        Vec_IntPush( p->vToks, (int)(pToken - pLine) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Preparses one chunk of the file.]
+
+  Description [Cuts the chunk into lines, removes comments and line 
+  extenders, collects directive lines and, if requested, tokenizes 
+  the .names lines. Touches only the characters of this chunk, so the
+  chunks can be processed concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_MvChunkProcess( void * pArg )
+{
+    Io_MvChunk_t * p = (Io_MvChunk_t *)pArg;
+    int fBlifMv = p->pMan->fBlifMv;
     char * pCur, * pPrev;
-    int i, fComment = 0;
-    Io_MvReplaceBuffersByShorts( p->pBuffer );
+    int i, Type, fComment = 0;
 
-    // parse the buffer into lines and remove comments
-    Vec_PtrPush( p->vLines, p->pBuffer );
-    for ( pCur = p->pBuffer; *pCur; pCur++ )
+    // parse the chunk into lines and remove comments
+    Vec_PtrPush( p->vLines, p->pBeg );
+    for ( pCur = p->pBeg; pCur < p->pEnd; pCur++ )
     {
         if ( *pCur == '\n' )
         {
             *pCur = 0;
-//            if ( *(pCur-1) == '\r' )
-//                *(pCur-1) = 0;
             fComment = 0;
-            Vec_PtrPush( p->vLines, pCur + 1 );
+            if ( pCur + 1 < p->pEnd || p->fLast )
+                Vec_PtrPush( p->vLines, pCur + 1 );
         }
         else if ( *pCur == '#' )
             fComment = 1;
@@ -767,17 +974,17 @@ static void Io_MvReadPreparse( Io_MvMan_t * p )
             *pCur = 0;
     }
 
-    // unfold the line extensions and sort lines by directive
+    // unfold the line extensions and collect the directives
     Vec_PtrForEachEntry( char *, p->vLines, pCur, i )
     {
         if ( *pCur == 0 )
             continue;
         // find previous non-space character
-        for ( pPrev = pCur - 2; pPrev >= p->pBuffer; pPrev-- )
+        for ( pPrev = pCur - 2; pPrev >= p->pBeg; pPrev-- )
             if ( !Io_MvCharIsSpace(*pPrev) )
                 break;
         // if it is the line extender, overwrite it with spaces
-        if ( pPrev >= p->pBuffer && *pPrev == '\\' )
+        if ( pPrev >= p->pBeg && *pPrev == '\\' )
         {
             for ( ; *pPrev; pPrev++ )
                 *pPrev = ' ';
@@ -790,75 +997,179 @@ static void Io_MvReadPreparse( Io_MvMan_t * p )
         if ( *(pCur-1) != '.' )
             continue;
         if ( !strncmp(pCur, "names", 5) || !strncmp(pCur, "table", 5) || !strncmp(pCur, "gate", 4) )
-            Vec_PtrPush( p->pLatest->vNames, pCur );
-        else if ( p->fBlifMv && (!strncmp(pCur, "def ", 4) || !strncmp(pCur, "default ", 8)) )
+            Type = IO_MV_NAMES;
+        else if ( fBlifMv && (!strncmp(pCur, "def ", 4) || !strncmp(pCur, "default ", 8)) )
             continue;
         else if ( !strncmp( pCur, "ltlformula", 10 ) )
-            Vec_PtrPush( p->pLatest->vLtlProperties, pCur );
+            Type = IO_MV_LTL;
         else if ( !strncmp(pCur, "latch", 5) )
-            Vec_PtrPush( p->pLatest->vLatches, pCur );
+            Type = IO_MV_LATCH;
         else if ( !strncmp(pCur, "flop", 4) )
-            Vec_PtrPush( p->pLatest->vFlops, pCur );
+            Type = IO_MV_FLOP;
         else if ( !strncmp(pCur, "r ", 2) || !strncmp(pCur, "reset ", 6) )
-            Vec_PtrPush( p->pLatest->vResets, pCur );
+            Type = IO_MV_RESET;
         else if ( !strncmp(pCur, "inputs", 6) )
-            Vec_PtrPush( p->pLatest->vInputs, pCur );
+            Type = IO_MV_INPUTS;
         else if ( !strncmp(pCur, "outputs", 7) )
-            Vec_PtrPush( p->pLatest->vOutputs, pCur );
+            Type = IO_MV_OUTPUTS;
         else if ( !strncmp(pCur, "subckt", 6) )
-            Vec_PtrPush( p->pLatest->vSubckts, pCur );
+            Type = IO_MV_SUBCKT;
         else if ( !strncmp(pCur, "short", 5) )
-            Vec_PtrPush( p->pLatest->vShorts, pCur );
+            Type = IO_MV_SHORT;
         else if ( !strncmp(pCur, "onehot", 6) )
-            Vec_PtrPush( p->pLatest->vOnehots, pCur );
-        else if ( p->fBlifMv && !strncmp(pCur, "mv", 2) )
-            Vec_PtrPush( p->pLatest->vMvs, pCur );
+            Type = IO_MV_ONEHOT;
+        else if ( fBlifMv && !strncmp(pCur, "mv", 2) )
+            Type = IO_MV_MV;
         else if ( !strncmp(pCur, "constraint", 10) )
-            Vec_PtrPush( p->pLatest->vConstrs, pCur );
+            Type = IO_MV_CONSTR;
         else if ( !strncmp(pCur, "blackbox", 8) )
-            p->pLatest->fBlackBox = 1;
+            Type = IO_MV_BLACKBOX;
         else if ( !strncmp(pCur, "model", 5) ) 
-        {
-            p->pLatest = Io_MvModAlloc();
-            p->pLatest->pName = pCur;
-            p->pLatest->pMan = p;
-        }
+            Type = IO_MV_MODEL;
         else if ( !strncmp(pCur, "end", 3) )
-        {
-            if ( p->pLatest )
-                Vec_PtrPush( p->vModels, p->pLatest );
-            p->pLatest = NULL;
-        }
+            Type = IO_MV_END;
         else if ( !strncmp(pCur, "exdc", 4) )
-        {
-//            fprintf( stdout, "Line %d: The design contains EXDC network (warning only).\n", Io_MvGetLine(p, pCur) );
-            fprintf( stdout, "Warning: The design contains EXDC network.\n" );
-            if ( p->pLatest )
-                Vec_PtrPush( p->vModels, p->pLatest );
-            p->pLatest = Io_MvModAlloc();
-            p->pLatest->pName = NULL;
-            p->pLatest->pMan = p;
-        }
+            Type = IO_MV_EXDC;
         else if ( !strncmp(pCur, "attrib", 6) )
-        {}
+            continue;
         else if ( !strncmp(pCur, "delay", 5) )
-        {}
+            continue;
         else if ( !strncmp(pCur, "input_", 6) )
-        {}
+            continue;
         else if ( !strncmp(pCur, "output_", 7) )
-        {}
+            continue;
         else if ( !strncmp(pCur, "no_merge", 8) )
-        {}
+            continue;
         else if ( !strncmp(pCur, "wd", 2) )
-        {}
+            continue;
 //        else if ( !strncmp(pCur, "inouts", 6) )
-//        {}
+//            continue;
         else
+            Type = IO_MV_SKIP;
+        Vec_PtrPush( p->vDirs, pCur );
+        Vec_IntPush( p->vTypes, Type );
+    }
+
+    // tokenize the .names lines after all line extensions are unfolded
+    if ( p->vToks )
+    {
+        Vec_Ptr_t * vTokens  = Vec_PtrAlloc( 100 );
+        Vec_Ptr_t * vTokens2 = Vec_PtrAlloc( 100 );
+        Vec_IntForEachEntry( p->vTypes, Type, i )
+            if ( Type == IO_MV_NAMES )
+                Io_MvChunkTokenize( p, (char *)Vec_PtrEntry(p->vDirs, i), vTokens, vTokens2 );
+        Vec_PtrFree( vTokens );
+        Vec_PtrFree( vTokens2 );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the parsing.]
+
+  Description [Performs several preliminary operations:
+  - Cuts the file buffer into separate lines.
+  - Removes comments and line extenders.
+  - Sorts lines by directives.
+  - Estimates the number of objects.
+  - Allocates room for the objects.
+  - Allocates room for the hash table.
+  The first two steps are done for the chunks of the file concurrently,
+  while the lines are sorted by directive in the file order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvReadPreparse( Io_MvMan_t * p )
+{
+    Io_MvChunk_t * pChunk;
+    char * pCur;
+    int i, k, Type, iTok;
+    Io_MvReplaceBuffersByShorts( p->pBuffer );
+
+    // preparse the chunks
+    Io_MvChunkStart( p );
+    if ( Vec_PtrSize(p->vChunks) == 1 )
+        Io_MvChunkProcess( Vec_PtrEntry(p->vChunks, 0) );
+    else
+        Util_ProcessThreads( Io_MvChunkProcess, p->vChunks, p->nProcs, 0, 0 );
+    Vec_PtrForEachEntry( Io_MvChunk_t *, p->vChunks, pChunk, i )
+        Vec_PtrAppend( p->vLines, pChunk->vLines );
+
+    // sort lines by directive
+    Vec_PtrForEachEntry( Io_MvChunk_t *, p->vChunks, pChunk, i )
+    {
+        iTok = 0;
+        Vec_PtrForEachEntry( char *, pChunk->vDirs, pCur, k )
         {
-            pCur--;
-            if ( pCur[strlen(pCur)-1] == '\r' )
-                pCur[strlen(pCur)-1] = 0;
-            fprintf( stdout, "Line %d: Skipping line \"%s\".\n", Io_MvGetLine(p, pCur), pCur );
+            Type = Vec_IntEntry( pChunk->vTypes, k );
+            if ( Type == IO_MV_NAMES )
+            {
+                Vec_PtrPush( p->pLatest->vNames, pCur );
+                if ( pChunk->vToks == NULL )
+                    continue;
+                if ( p->pLatest->vNameToks == NULL )
+                    p->pLatest->vNameToks = Vec_WrdAlloc( 512 );
+                Vec_WrdPush( p->pLatest->vNameToks, ((word)i << 32) | (word)iTok );
+                iTok += 2 + Vec_IntEntry(pChunk->vToks, iTok) + Vec_IntEntry(pChunk->vToks, iTok+1);
+            }
+            else if ( Type == IO_MV_LTL )
+                Vec_PtrPush( p->pLatest->vLtlProperties, pCur );
+            else if ( Type == IO_MV_LATCH )
+                Vec_PtrPush( p->pLatest->vLatches, pCur );
+            else if ( Type == IO_MV_FLOP )
+                Vec_PtrPush( p->pLatest->vFlops, pCur );
+            else if ( Type == IO_MV_RESET )
+                Vec_PtrPush( p->pLatest->vResets, pCur );
+            else if ( Type == IO_MV_INPUTS )
+                Vec_PtrPush( p->pLatest->vInputs, pCur );
+            else if ( Type == IO_MV_OUTPUTS )
+                Vec_PtrPush( p->pLatest->vOutputs, pCur );
+            else if ( Type == IO_MV_SUBCKT )
+                Vec_PtrPush( p->pLatest->vSubckts, pCur );
+            else if ( Type == IO_MV_SHORT )
+                Vec_PtrPush( p->pLatest->vShorts, pCur );
+            else if ( Type == IO_MV_ONEHOT )
+                Vec_PtrPush( p->pLatest->vOnehots, pCur );
+            else if ( Type == IO_MV_MV )
+                Vec_PtrPush( p->pLatest->vMvs, pCur );
+            else if ( Type == IO_MV_CONSTR )
+                Vec_PtrPush( p->pLatest->vConstrs, pCur );
+            else if ( Type == IO_MV_BLACKBOX )
+                p->pLatest->fBlackBox = 1;
+            else if ( Type == IO_MV_MODEL )
+            {
+                p->pLatest = Io_MvModAlloc();
+                p->pLatest->pName = pCur;
+                p->pLatest->pMan = p;
+            }
+            else if ( Type == IO_MV_END )
+            {
+                if ( p->pLatest )
+                    Vec_PtrPush( p->vModels, p->pLatest );
+                p->pLatest = NULL;
+            }
+            else if ( Type == IO_MV_EXDC )
+            {
+//                fprintf( stdout, "Line %d: The design contains EXDC network (warning only).\n", Io_MvGetLine(p, pCur) );
+                fprintf( stdout, "Warning: The design contains EXDC network.\n" );
+                if ( p->pLatest )
+                    Vec_PtrPush( p->vModels, p->pLatest );
+                p->pLatest = Io_MvModAlloc();
+                p->pLatest->pName = NULL;
+                p->pLatest->pMan = p;
+            }
+            else 
+            {
+                assert( Type == IO_MV_SKIP );
+                pCur--;
+                if ( pCur[strlen(pCur)-1] == '\r' )
+                    pCur[strlen(pCur)-1] = 0;
+                fprintf( stdout, "Line %d: Skipping line \"%s\".\n", Io_MvGetLine(p, pCur), pCur );
+            }
         }
     }
 }
@@ -885,6 +1196,9 @@ static int Io_MvReadInterfaces( Io_MvMan_t * p )
         // parse the model
         if ( !Io_MvParseLineModel( pMod, pMod->pName ) )
             return 0;
+        // make room for the names of the nets defined by the lines of this model
+        Nm_ManReserve( pMod->pNtk->pManName, Vec_PtrSize(pMod->vNames) + Vec_PtrSize(pMod->vLatches) + 
+            Vec_PtrSize(pMod->vFlops) + Vec_PtrSize(pMod->vShorts) + Vec_PtrSize(pMod->vSubckts) );
         // add model to the design
         if ( !Abc_DesAddModel( p->pDesign, pMod->pNtk ) )
         {
@@ -988,7 +1302,7 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
         else
         {
             Vec_PtrForEachEntry( char *, pMod->vNames, pLine, k )
-                if ( !Io_MvParseLineNamesBlif( pMod, pLine ) )
+                if ( !Io_MvParseLineNamesBlif( pMod, pLine, k ) )
                     return NULL;
             Vec_PtrForEachEntry( char *, pMod->vShorts, pLine, k )
                 if ( !Io_MvParseLineShortBlif( pMod, pLine ) )
@@ -2036,8 +2350,9 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
     int i, Polarity = -1;
 
     p->pMan->nTablesRead++;
-    // get the tokens
-    Io_MvSplitIntoTokens( vTokens, pTable, '.' );
+    // get the tokens (unless they are already there)
+    if ( pTable )
+        Io_MvSplitIntoTokens( vTokens, pTable, '.' );
     if ( Vec_PtrSize(vTokens) == 0 )
         return Abc_SopCreateConst0( (Mem_Flex_t *)p->pNtk->pManFunc );
     if ( Vec_PtrSize(vTokens) == 1 )
@@ -2102,13 +2417,16 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
   SeeAlso     []
 
 ***********************************************************************/
-static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
+static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine, int iLine )
 {
     Vec_Ptr_t * vTokens = p->pMan->vTokens;
     Abc_Obj_t * pNet, * pNode;
     char * pName;
     assert( !p->pMan->fBlifMv );
-    Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+    if ( p->vNameToks )
+        Io_MvReadTokens( p, pLine, iLine, 0 );
+    else
+        Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
     // parse the mapped node
     if ( !strcmp((char *)Vec_PtrEntry(vTokens,0), "gate") )
         return Io_MvParseLineGateBlif( p, vTokens );
@@ -2124,7 +2442,13 @@ static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
     // create fanins
     pNode = Io_ReadCreateNode( p->pNtk, pName, (char **)(vTokens->pArray + 1), Vec_PtrSize(vTokens) - 2 );
     // parse the table of this node
-    pNode->pData = Io_MvParseTableBlif( p, pName + strlen(pName), Abc_ObjFaninNum(pNode) );
+    if ( p->vNameToks )
+    {
+        Io_MvReadTokens( p, pLine, iLine, 1 );
+        pNode->pData = Io_MvParseTableBlif( p, NULL, Abc_ObjFaninNum(pNode) );
+    }
+    else
+        pNode->pData = Io_MvParseTableBlif( p, pName + strlen(pName), Abc_ObjFaninNum(pNode) );
     if ( pNode->pData == NULL )
         return 0;
     pNode->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, (char *)pNode->pData );
@@ -46,13 +46,29 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 Abc_Ntk_t * Io_ReadVerilog( char * pFileName, int fCheck )
+{
+    return Io_ReadVerilogProcs( pFileName, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads hierarchical design from the Verilog file using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadVerilogProcs( char * pFileName, int fCheck, int nProcs )
 {
     Abc_Ntk_t * pNtk, * pTemp;
     Abc_Des_t * pDesign;
     int i, RetValue;
 
     // parse the verilog file
-    pDesign = Ver_ParseFile( pFileName, NULL, fCheck, 1 );
+    pDesign = Ver_ParseFileProcs( pFileName, NULL, fCheck, 1, nProcs );
     if ( pDesign == NULL )
         return NULL;
 
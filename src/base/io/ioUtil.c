@@ -97,6 +97,23 @@ Io_FileType_t Io_ReadFileType( char * pFileName )
 
 ***********************************************************************/
 Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck )
+{
+    return Io_ReadNetlistProcs( pFileName, FileType, fCheck, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Read the network from a file using several threads.]
+
+  Description [The number of threads is used by the parsers that 
+  support it and ignored by the other ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadNetlistProcs( char * pFileName, Io_FileType_t FileType, int fCheck, int nProcs )
 {
     FILE * pFile;
     Abc_Ntk_t * pNtk;
@@ -135,9 +152,9 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
     // read the new netlist
     if ( FileType == IO_FILE_BLIF )
 //        pNtk = Io_ReadBlif( pFileName, fCheck );
-        pNtk = Io_ReadBlifMv( pFileName, 0, fCheck );
+        pNtk = Io_ReadBlifMvProcs( pFileName, 0, fCheck, nProcs );
     else if ( Io_ReadFileType(pFileName) == IO_FILE_BLIFMV )
-        pNtk = Io_ReadBlifMv( pFileName, 1, fCheck );
+        pNtk = Io_ReadBlifMvProcs( pFileName, 1, fCheck, nProcs );
     else if ( FileType == IO_FILE_BENCH )
         pNtk = Io_ReadBench( pFileName, fCheck );
     else if ( FileType == IO_FILE_EDIF )
@@ -147,7 +164,7 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
     else if ( FileType == IO_FILE_PLA )
         pNtk = Io_ReadPla( pFileName, 0, 0, 0, 0, fCheck );
     else if ( FileType == IO_FILE_VERILOG )
-        pNtk = Io_ReadVerilog( pFileName, fCheck );
+        pNtk = Io_ReadVerilogProcs( pFileName, fCheck, nProcs );
     else 
     {
         fprintf( stderr, "Unknown file format.\n" );
@@ -239,11 +256,27 @@ void updateLtlStoreOfNtk( Abc_Ntk_t *pNtk, Vec_Ptr_t *tempLtlStore )
 
 ***********************************************************************/
 Abc_Ntk_t * Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs )
+{
+    return Io_ReadProcs( pFileName, FileType, fCheck, fBarBufs, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Read the network from a file using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadProcs( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs, int nProcs )
 {
     Abc_Ntk_t * pNtk, * pTemp;
     Vec_Ptr_t * vLtl;
     // get the netlist
-    pNtk = Io_ReadNetlist( pFileName, FileType, fCheck );
+    pNtk = Io_ReadNetlistProcs( pFileName, FileType, fCheck, nProcs );
     if ( pNtk == NULL )
         return NULL;
     vLtl = temporaryLtlStore( pNtk );
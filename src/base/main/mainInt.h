@@ -91,6 +91,8 @@ struct Abc_Frame_t_
     // used for runtime measurement
     double          TimeCommand;   // the runtime of the last command
     double          TimeTotal;     // the total runtime of all commands
+    Vec_Ptr_t *     vCmdProfs;     // the memory profile of the commands
+    Vec_Ptr_t *     vCmdSteps;     // the memory profile of the command invocations
     // temporary storage for structural choices
     Vec_Ptr_t *     vStore;        // networks to be used by choice
     // decomposition package    
@@ -166,6 +168,7 @@ struct Abc_Frame_t_
     int *           pBoxes;
     void *          pNdr;
     int *           pNdrArray;
+    void *          pBmc3Session;  // unrolling and solver kept by "bmc3 -k"
 
     Abc_Frame_Callback_BmcFrameDone_Func pFuncOnFrameDone;
 };
@@ -51,6 +51,7 @@ struct Ver_Man_t_
     int             fMapped;       // mapped verilog
     int             fUseMemMan;    // allocate memory manager in the networks
     int             fCheck;        // checks network for currectness
+    int             nProcs;        // the number of threads used to parse the modules
     // input file stream
     char *          pFileName;
     Ver_Stream_t *  pReader;
@@ -86,6 +87,7 @@ struct Ver_Man_t_
 
 /*=== verCore.c ========================================================*/
 extern Abc_Des_t *    Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan );
+extern Abc_Des_t *    Ver_ParseFileProcs( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan, int nProcs );
 extern void           Ver_ParsePrintErrorMessage( Ver_Man_t * p );
 /*=== verFormula.c ========================================================*/
 extern void *         Ver_FormulaParser( char * pFormula, void * pMan, Vec_Ptr_t * vNames, Vec_Ptr_t * vStackFn, Vec_Int_t * vStackOp, char * pErrorMessage );
@@ -95,6 +97,9 @@ extern int            Ver_ParseSkipComments( Ver_Man_t * p );
 extern char *         Ver_ParseGetName( Ver_Man_t * p );
 /*=== verStream.c ========================================================*/
 extern Ver_Stream_t * Ver_StreamAlloc( char * pFileName );
+extern Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBuffer, iword nChars );
+extern char *         Ver_StreamLoadFile( char * pFileName, iword * pnChars, int * pfMapped );
+extern void           Ver_StreamUnloadFile( char * pContents, iword nChars, int fMapped );
 extern void           Ver_StreamFree( Ver_Stream_t * p );
 extern char *         Ver_StreamGetFileName( Ver_Stream_t * p );
 extern int            Ver_StreamGetFileSize( Ver_Stream_t * p );
@@ -55,6 +55,7 @@ static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
 static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
+static int  Ver_ParseModulesPar( Ver_Man_t * p );
 static int  Ver_ParseModule( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -76,6 +77,8 @@ static void Ver_ParseRemoveSuffixTable( Ver_Man_t * pMan );
 
 static inline int Ver_NtkIsDefined( Abc_Ntk_t * pNtkBox )  { assert( pNtkBox->pName );     return Abc_NtkPiNum(pNtkBox) || Abc_NtkPoNum(pNtkBox);  }
 static inline int Ver_ObjIsConnected( Abc_Obj_t * pObj )   { assert( Abc_ObjIsBox(pObj) ); return Abc_ObjFaninNum(pObj) || Abc_ObjFanoutNum(pObj); }
+static inline int Ver_NtkIsParsed( Abc_Ntk_t * pNtk )       { return pNtk->ntkFunc != ABC_FUNC_BLACKBOX || Abc_NtkObjNum(pNtk) > 0;          }
+static inline int Ver_CharIsDelim( char c )                 { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '(' || c == ')' || c == ',' || c == ';'; }
 
 int glo_fMapped = 0; // this is bad!
 
@@ -163,6 +166,25 @@ void Ver_ParseStop( Ver_Man_t * p )
 
 ***********************************************************************/
 Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan )
+{
+    return Ver_ParseFileProcs( pFileName, pGateLib, fCheck, fUseMemMan, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [File parser using several threads.]
+
+  Description [With more than one thread, the file is mapped into memory 
+  and split into groups of modules, which are parsed concurrently into 
+  separate designs; these are then merged in the order of the file 
+  before the boxes are connected.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Des_t * Ver_ParseFileProcs( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan, int nProcs )
 {
     Ver_Man_t * p;
     Abc_Des_t * pDesign;
@@ -171,6 +193,7 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
     p->fMapped    = glo_fMapped;
     p->fCheck     = fCheck;
     p->fUseMemMan = fUseMemMan;
+    p->nProcs     = Abc_MaxInt( nProcs, 1 );
     if ( glo_fMapped )
     {
         Hop_ManStop((Hop_Man_t *)p->pDesign->pManFunc);
@@ -204,25 +227,28 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     int i;
 
     // preparse the modeles
-    pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
-    while ( 1 )
+    if ( !Ver_ParseModulesPar( pMan ) )
     {
-        // get the next token
-        pToken = Ver_ParseGetName( pMan );
-        if ( pToken == NULL )
-            break;
-        if ( strcmp( pToken, "module" ) )
+        pMan->pProgress = Extra_ProgressBarStart( stdout, Ver_StreamGetFileSize(pMan->pReader) );
+        while ( 1 )
         {
-            sprintf( pMan->sError, "Cannot read \"module\" directive." );
-            Ver_ParsePrintErrorMessage( pMan );
-            return;
+            // get the next token
+            pToken = Ver_ParseGetName( pMan );
+            if ( pToken == NULL )
+                break;
+            if ( strcmp( pToken, "module" ) )
+            {
+                sprintf( pMan->sError, "Cannot read \"module\" directive." );
+                Ver_ParsePrintErrorMessage( pMan );
+                return;
+            }
+            // parse the module
+            if ( !Ver_ParseModule(pMan) )
+                return;
         }
-        // parse the module
-        if ( !Ver_ParseModule(pMan) )
-            return;
+        Extra_ProgressBarStop( pMan->pProgress );
+        pMan->pProgress = NULL;
     }
-    Extra_ProgressBarStop( pMan->pProgress );
-    pMan->pProgress = NULL;
 
     // process defined and undefined boxes
     if ( !Ver_ParseAttachBoxes( pMan ) )
@@ -244,6 +270,268 @@ void Ver_ParseInternal( Ver_Man_t * pMan )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the positions following the top-level "endmodule" keywords.]
+
+  Description [Skips comments and escaped identifiers, which may contain
+  the keyword without ending the module.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParseFindModuleEnds( char * pBuffer, char * pLimit, Vec_Ptr_t * vEnds )
+{
+    char * pCur = pBuffer;
+    while ( pCur < pLimit )
+    {
+        if ( pCur[0] == '/' && pCur + 1 < pLimit && pCur[1] == '/' )
+        {
+            while ( pCur < pLimit && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        if ( pCur[0] == '/' && pCur + 1 < pLimit && pCur[1] == '*' )
+        {
+            for ( pCur += 2; pCur + 1 < pLimit && !(pCur[0] == '*' && pCur[1] == '/'); pCur++ );
+            pCur += 2;
+            continue;
+        }
+        if ( pCur[0] == '\\' )
+        {
+            while ( pCur < pLimit && *pCur != ' ' && *pCur != '\t' && *pCur != '\r' && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        if ( pCur[0] == 'e' && (pCur == pBuffer || Ver_CharIsDelim(pCur[-1])) && pLimit - pCur >= 9 && 
+             !strncmp(pCur, "endmodule", 9) && (pCur + 9 == pLimit || Ver_CharIsDelim(pCur[9])) )
+        {
+            pCur += 9;
+            Vec_PtrPush( vEnds, pCur );
+            continue;
+        }
+        pCur++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the parser of a group of modules.]
+
+  Description [The parser has its own design, which shares the libraries
+  with the main one but not the AIG manager of the local functions.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Ver_Man_t * Ver_ParseStartChunk( Ver_Man_t * pMan, char * pBeg, char * pEnd )
+{
+    Ver_Man_t * p;
+    p = ABC_ALLOC( Ver_Man_t, 1 );
+    memset( p, 0, sizeof(Ver_Man_t) );
+    p->pFileName  = pMan->pFileName;
+    p->fMapped    = pMan->fMapped;
+    p->fCheck     = pMan->fCheck;
+    p->fUseMemMan = pMan->fUseMemMan;
+    p->pReader    = Ver_StreamAllocMem( pMan->pFileName, pBeg, (iword)(pEnd - pBeg) );
+    p->Output     = NULL;
+    p->vNames     = Vec_PtrAlloc( 100 );
+    p->vStackFn   = Vec_PtrAlloc( 100 );
+    p->vStackOp   = Vec_IntAlloc( 100 );
+    p->vPerm      = Vec_IntAlloc( 100 );
+    p->pDesign    = Abc_DesCreate( pMan->pFileName );
+    p->pDesign->pLibrary = pMan->pDesign->pLibrary;
+    p->pDesign->pGenlib  = pMan->pDesign->pGenlib;
+    if ( pMan->pDesign->pManFunc == NULL )
+    {
+        Hop_ManStop( (Hop_Man_t *)p->pDesign->pManFunc );
+        p->pDesign->pManFunc = NULL;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses a group of modules.]
+
+  Description [Called by the threads. Any error is only recorded, because
+  the file is then parsed again sequentially to report it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParseChunk( void * pArg )
+{
+    Ver_Man_t * p = (Ver_Man_t *)pArg;
+    char * pToken;
+    while ( !p->fError )
+    {
+        pToken = Ver_ParseGetName( p );
+        if ( pToken == NULL )
+            break;
+        if ( strcmp( pToken, "module" ) || !Ver_ParseModule(p) )
+            p->fError = 1;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the modules of the group into the main design.]
+
+  Description [Modules are added in the order of their first appearance,
+  as the sequential parser does. A module defined here replaces the 
+  placeholder created when it was instantiated in an earlier group; 
+  placeholders for modules known to the main design are collected in 
+  vDrop. The local functions are transferred into the main AIG manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParseMergeChunk( Ver_Man_t * pMan, Ver_Man_t * p, Vec_Ptr_t * vDrop )
+{
+    Abc_Des_t * pDesign = pMan->pDesign;
+    Abc_Ntk_t * pNtk, * pNtkOld;
+    Abc_Obj_t * pObj;
+    char * pKey;
+    int i, k;
+    Vec_PtrForEachEntry( Abc_Ntk_t *, p->pDesign->vModules, pNtk, i )
+    {
+        if ( Abc_NtkHasAig(pNtk) && pNtk->pManFunc != pDesign->pManFunc )
+        {
+            Abc_NtkForEachNode( pNtk, pObj, k )
+                pObj->pData = Hop_Transfer( (Hop_Man_t *)pNtk->pManFunc, (Hop_Man_t *)pDesign->pManFunc, (Hop_Obj_t *)pObj->pData, Abc_ObjFaninNum(pObj) );
+            pNtk->pManFunc = pDesign->pManFunc;
+        }
+        pNtkOld = Abc_DesFindModelByName( pDesign, pNtk->pName );
+        if ( pNtkOld == NULL )
+        {
+            pNtk->Id = 0;
+            pNtk->pDesign = NULL;
+            Abc_DesAddModel( pDesign, pNtk );
+        }
+        else if ( Ver_NtkIsParsed(pNtk) )
+        {
+            assert( !Ver_NtkIsParsed(pNtkOld) );
+            pKey = pNtkOld->pName;
+            st__delete( pDesign->tModules, (const char **)&pKey, NULL );
+            st__insert( pDesign->tModules, pNtk->pName, (char *)pNtk );
+            pNtk->Id = pNtkOld->Id;
+            pNtk->pDesign = pDesign;
+            Vec_PtrWriteEntry( pDesign->vModules, pNtk->Id, pNtk );
+            Vec_PtrPush( vDrop, pNtkOld );
+        }
+        else
+            Vec_PtrPush( vDrop, pNtk );
+    }
+    Vec_PtrClear( p->pDesign->vModules );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules using several threads.]
+
+  Description [Returns 1 if the modules are parsed and merged into the 
+  main design. Returns 0 if the file is not split into several groups, 
+  or if a group has an error, or if a module is defined in more than 
+  one group; the caller then parses the file sequentially, which gives 
+  the same messages as before.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ver_ParseModulesPar( Ver_Man_t * pMan )
+{
+    Vec_Ptr_t * vEnds, * vChunks, * vDrop;
+    Ver_Man_t * p;
+    Abc_Ntk_t * pNtk, * pNtkBox;
+    Abc_Obj_t * pObj;
+    st__table * tDefined;
+    char * pBuffer, * pBeg, * pEnd;
+    iword nChars, nTarget;
+    int i, k, nChunks, fMapped, RetValue = 1;
+    if ( pMan->nProcs <= 1 )
+        return 0;
+    pBuffer = Ver_StreamLoadFile( pMan->pFileName, &nChars, &fMapped );
+    if ( pBuffer == NULL )
+        return 0;
+    // group the modules into chunks of about the same size
+    vEnds = Vec_PtrAlloc( 100 );
+    Ver_ParseFindModuleEnds( pBuffer, pBuffer + nChars, vEnds );
+    nChunks = (int)Abc_MinWord( (word)Abc_MinInt(4 * pMan->nProcs, Vec_PtrSize(vEnds)), (word)(nChars >> 20) );
+    if ( nChunks <= 1 )
+    {
+        Vec_PtrFree( vEnds );
+        Ver_StreamUnloadFile( pBuffer, nChars, fMapped );
+        return 0;
+    }
+    nTarget = nChars / nChunks;
+    vChunks = Vec_PtrAlloc( nChunks );
+    pBeg = pBuffer;
+    Vec_PtrForEachEntryStop( char *, vEnds, pEnd, i, Vec_PtrSize(vEnds) - 1 )
+    {
+        if ( pEnd - pBeg < nTarget )
+            continue;
+        Vec_PtrPush( vChunks, Ver_ParseStartChunk(pMan, pBeg, pEnd) );
+        pBeg = pEnd;
+    }
+    Vec_PtrPush( vChunks, Ver_ParseStartChunk(pMan, pBeg, pBuffer + nChars) );
+    Vec_PtrFree( vEnds );
+    // parse the chunks
+    Util_ProcessThreads( Ver_ParseChunk, vChunks, pMan->nProcs, 0, 0 );
+    // check that the chunks are parsed and each module is defined once
+    tDefined = st__init_table( strcmp, st__strhash );
+    Vec_PtrForEachEntry( Ver_Man_t *, vChunks, p, i )
+    {
+        if ( p->fError )
+        {
+            RetValue = 0;
+            break;
+        }
+        Vec_PtrForEachEntry( Abc_Ntk_t *, p->pDesign->vModules, pNtk, k )
+            if ( Ver_NtkIsParsed(pNtk) && st__insert( tDefined, pNtk->pName, NULL ) )
+                RetValue = 0;
+    }
+    st__free_table( tDefined );
+    // merge the designs in the order of the file
+    vDrop = Vec_PtrAlloc( 100 );
+    if ( RetValue )
+    {
+        Vec_PtrForEachEntry( Ver_Man_t *, vChunks, p, i )
+            Ver_ParseMergeChunk( pMan, p, vDrop );
+        // point the boxes to the models of the main design
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pMan->pDesign->vModules, pNtk, i )
+            Abc_NtkForEachBox( pNtk, pObj, k )
+                if ( Abc_ObjIsBlackbox(pObj) && (pNtkBox = (Abc_Ntk_t *)pObj->pData) )
+                    pObj->pData = Abc_DesFindModelByName( pMan->pDesign, pNtkBox->pName );
+    }
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vDrop, pNtk, i )
+    {
+        pNtk->pDesign = NULL;
+        Abc_NtkDelete( pNtk );
+    }
+    Vec_PtrFree( vDrop );
+    // stop the parsers of the chunks
+    Vec_PtrForEachEntry( Ver_Man_t *, vChunks, p, i )
+    {
+        Ver_ParseFreeData( p );
+        Ver_ParseStop( p );
+    }
+    Vec_PtrFree( vChunks );
+    Ver_StreamUnloadFile( pBuffer, nChars, fMapped );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [File parser.]
@@ -278,7 +566,9 @@ void Ver_ParseFreeData( Ver_Man_t * p )
 void Ver_ParsePrintErrorMessage( Ver_Man_t * p )
 {
     p->fError = 1;
-    if ( p->fTopLevel ) // the line number is not given
+    if ( p->Output == NULL ) // the chunk parsed by a thread is silent
+        ;
+    else if ( p->fTopLevel ) // the line number is not given
         fprintf( p->Output, "%s: %s\n", p->pFileName, p->sError );
     else // print the error message with the line number
         fprintf( p->Output, "%s (line %d): %s\n", 
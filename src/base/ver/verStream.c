@@ -20,6 +20,13 @@
 
 #include "ver.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -52,6 +59,7 @@ struct Ver_Stream_t_
     int              nChars;        // the total number of characters in the word
     // status of the parser
     int              fStop;         // this flag goes high when the end of file is reached
+    int              fBorrowed;     // the buffer belongs to the caller
 };
 
 static void Ver_StreamReload( Ver_Stream_t * p );
@@ -110,6 +118,97 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the part of the file already in memory.]
+
+  Description [The buffer is not copied and should remain valid until
+  the reader is stopped. It is not modified by the reader.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBuffer, iword nChars )
+{
+    Ver_Stream_t * p;
+    p = ABC_ALLOC( Ver_Stream_t, 1 );
+    memset( p, 0, sizeof(Ver_Stream_t) );
+    p->pFileName   = pFileName;
+    p->nFileSize   = nChars;
+    p->nFileRead   = nChars;
+    p->nBufferSize = nChars;
+    p->pBuffer     = pBuffer;
+    p->pBufferCur  = pBuffer;
+    // the data is loaded in full, so the reader never reloads
+    p->pBufferEnd  = pBuffer + nChars;
+    p->pBufferStop = p->pBufferEnd;
+    p->fBorrowed   = 1;
+    p->nLineCounter = 1; // 1-based line counting
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory or reads it into the heap.]
+
+  Description [Returns the contents, which are not zero-terminated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Ver_StreamLoadFile( char * pFileName, iword * pnChars, int * pfMapped )
+{
+    char * pContents;
+    FILE * pFile;
+    *pfMapped = 0;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd < 0 )
+            return NULL;
+        if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( pMap != MAP_FAILED )
+            {
+                *pnChars = (iword)Stat.st_size;
+                *pfMapped = 1;
+                close( fd );
+                return (char *)pMap;
+            }
+        }
+        close( fd );
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    *pnChars = (iword)ftell( pFile );
+    rewind( pFile );
+    pContents = ABC_ALLOC( char, *pnChars + 1 );
+    if ( fread( pContents, 1, (size_t)*pnChars, pFile ) != (size_t)*pnChars )
+        ABC_FREE( pContents );
+    fclose( pFile );
+    return pContents;
+}
+void Ver_StreamUnloadFile( char * pContents, iword nChars, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, (size_t)nChars );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Loads new data into the file reader.]
@@ -158,7 +257,8 @@ void Ver_StreamFree( Ver_Stream_t * p )
 {
     if ( p->pFile )
         fclose( p->pFile );
-    ABC_FREE( p->pBuffer );
+    if ( !p->fBorrowed )
+        ABC_FREE( p->pBuffer );
     ABC_FREE( p );
 }
 
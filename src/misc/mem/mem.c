@@ -50,6 +50,7 @@ struct Mem_Fixed_t_
     // statistics
     int           nMemoryUsed;   // memory used in the allocated entries
     int           nMemoryAlloc;  // memory allocated
+    int           iProf;         // the kind of pool for memory profiling
 };
 
 struct Mem_Flex_t_
@@ -79,6 +80,7 @@ struct Mem_Step_t_
     int             nLargeChunksAlloc;  // the maximum number of large memory chunks
     int             nLargeChunks;       // the current number of large memory chunks
     void **         pLargeChunks;       // the allocated large memory chunks
+    iword           nLargeBytes;        // the memory allocated in the large chunks
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -122,6 +124,7 @@ Mem_Fixed_t * Mem_FixedStart( int nEntrySize )
 
     p->nMemoryUsed   = 0;
     p->nMemoryAlloc  = 0;
+    p->iProf         = ABC_MEM_PROF_FIXED;
     return p;
 }
 
@@ -148,6 +151,7 @@ void Mem_FixedStop( Mem_Fixed_t * p, int fVerbose )
         printf( "   Entries used = %8d. Entries peak = %8d. Memory used = %8d. Memory alloc = %8d.\n",
             p->nEntriesUsed, p->nEntriesMax, p->nEntrySize * p->nEntriesUsed, p->nMemoryAlloc );
     }
+    Abc_MemProfAdd( p->iProf, -(iword)p->nMemoryAlloc );
     for ( i = 0; i < p->nChunks; i++ )
         ABC_FREE( p->pChunks[i] );
     ABC_FREE( p->pChunks );
@@ -197,6 +201,7 @@ char * Mem_FixedEntryFetch( Mem_Fixed_t * p )
         }
         p->pEntriesFree = ABC_ALLOC( char, p->nEntrySize * p->nChunkSize );
         p->nMemoryAlloc += p->nEntrySize * p->nChunkSize;
+        Abc_MemProfAdd( p->iProf, (iword)p->nEntrySize * p->nChunkSize );
         // transform these entries into a linked list
         pTemp = p->pEntriesFree;
         for ( i = 1; i < p->nChunkSize; i++ )
@@ -273,6 +278,7 @@ void Mem_FixedRestart( Mem_Fixed_t * p )
     // set the free entry list
     p->pEntriesFree  = p->pChunks[0];
     // set the correct statistics
+    Abc_MemProfAdd( p->iProf, (iword)p->nEntrySize * p->nChunkSize - p->nMemoryAlloc );
     p->nMemoryAlloc  = p->nEntrySize * p->nChunkSize;
     p->nMemoryUsed   = 0;
     p->nEntriesAlloc = p->nChunkSize;
@@ -368,6 +374,7 @@ void Mem_FlexStop( Mem_Flex_t * p, int fVerbose )
         printf( "   Entries used = %d. Memory used = %d. Memory alloc = %d.\n",
             p->nEntriesUsed, p->nMemoryUsed, p->nMemoryAlloc );
     }
+    Abc_MemProfAdd( ABC_MEM_PROF_FLEX, -(iword)p->nMemoryAlloc );
     for ( i = 0; i < p->nChunks; i++ )
         ABC_FREE( p->pChunks[i] );
     ABC_FREE( p->pChunks );
@@ -405,6 +412,7 @@ char * Mem_FlexEntryFetch( Mem_Flex_t * p, int nBytes )
         p->pCurrent = ABC_ALLOC( char, p->nChunkSize );
         p->pEnd     = p->pCurrent + p->nChunkSize;
         p->nMemoryAlloc += p->nChunkSize;
+        Abc_MemProfAdd( ABC_MEM_PROF_FLEX, p->nChunkSize );
         // add the chunk to the chunk storage
         p->pChunks[ p->nChunks++ ] = p->pCurrent;
     }
@@ -439,6 +447,7 @@ void Mem_FlexRestart( Mem_Flex_t * p )
     for ( i = 1; i < p->nChunks; i++ )
         ABC_FREE( p->pChunks[i] );
     p->nChunks  = 1;
+    Abc_MemProfAdd( ABC_MEM_PROF_FLEX, (iword)p->nChunkSize - p->nMemoryAlloc );
     p->nMemoryAlloc = p->nChunkSize;
     // transform these entries into a linked list
     p->pCurrent = p->pChunks[0];
@@ -497,7 +506,10 @@ Mem_Step_t * Mem_StepStart( int nSteps )
     // start the fixed memory managers
     p->pMems = ABC_ALLOC( Mem_Fixed_t *, p->nMems );
     for ( i = 0; i < p->nMems; i++ )
+    {
         p->pMems[i] = Mem_FixedStart( (8<<i) );
+        p->pMems[i]->iProf = ABC_MEM_PROF_STEP;
+    }
     // set up the mapping of the required memory size into the corresponding manager
     p->nMapSize = (4<<p->nMems);
     p->pMap = ABC_ALLOC( Mem_Fixed_t *, p->nMapSize+1 );
@@ -528,6 +540,7 @@ void Mem_StepStop( Mem_Step_t * p, int fVerbose )
     int i;
     for ( i = 0; i < p->nMems; i++ )
         Mem_FixedStop( p->pMems[i], fVerbose );
+    Abc_MemProfAdd( ABC_MEM_PROF_STEP, -p->nLargeBytes );
     if ( p->pLargeChunks ) 
     {
         for ( i = 0; i < p->nLargeChunks; i++ )
@@ -566,6 +579,8 @@ char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
             p->pLargeChunks = (void **)ABC_REALLOC( char *, p->pLargeChunks, p->nLargeChunksAlloc ); 
         }
         p->pLargeChunks[ p->nLargeChunks++ ] = ABC_ALLOC( char, nBytes );
+        p->nLargeBytes += nBytes;
+        Abc_MemProfAdd( ABC_MEM_PROF_STEP, nBytes );
         return (char *)p->pLargeChunks[ p->nLargeChunks - 1 ];
     }
     return Mem_FixedEntryFetch( p->pMap[nBytes] );
@@ -97,6 +97,24 @@ int Nm_ManNumEntries( Nm_Man_t * p )
     return p->nEntries;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the manager for adding many names at once.]
+
+  Description [The total number of entries expected after the additions
+  is given. Readers call this before interning the names of a large
+  netlist, to avoid rehashing the tables repeatedly while they grow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManReserve( Nm_Man_t * p, int nEntries )
+{
+    Nm_ManTableReserve( p, nEntries );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates a new entry in the name manager.]
@@ -261,6 +261,35 @@ typedef ABC_INT64_T iword;
 #define ABC_PRMn(a,f)   (Abc_Print(1, "%s =", (a)), Abc_Print(1, "%10.3f MB  ",    1.0*((double)(f))/(1<<20)))
 #define ABC_PRMP(a,f,F) (Abc_Print(1, "%s =", (a)), Abc_Print(1, "%10.3f MB (%6.2f %%)\n",  (1.0*((double)(f))/(1<<20)), (((double)(F))? 100.0*((double)(f))/((double)(F)) : 0.0) ) )
 
+// memory profiling (the pool counters are always maintained, the heap counters
+// are maintained when ABC is compiled with ABC_USE_MEM_PROFILE)
+#define ABC_MEM_PROF_HEAP   0    // ABC_ALLOC() and friends
+#define ABC_MEM_PROF_FIXED  1    // Mem_Fixed_t
+#define ABC_MEM_PROF_FLEX   2    // Mem_Flex_t
+#define ABC_MEM_PROF_STEP   3    // Mem_Step_t
+#define ABC_MEM_PROF_POOLS  4    // all of the above pools
+#define ABC_MEM_PROF_NUM    5
+
+extern void   Abc_MemProfAdd( int iKind, iword nBytes );
+extern void   Abc_MemProfRead( int iKind, iword * pnLive, iword * pnPeak, iword * pnBytes, iword * pnAllocs );
+extern iword  Abc_MemProfPeakReset( int iKind );
+extern void   Abc_MemProfPeakRestore( int iKind, iword nPeak );
+extern iword  Abc_MemProfPeakTotal( int iKind );
+extern int    Abc_MemProfIsHeap( void );
+extern iword  Abc_MemProfPeakRss( void );
+extern void * Abc_MemProfMalloc( size_t nBytes );
+extern void * Abc_MemProfCalloc( size_t nItems, size_t nSize );
+extern void * Abc_MemProfRealloc( void * p, size_t nBytes );
+extern void   Abc_MemProfFree( void * p );
+
+#ifdef ABC_USE_MEM_PROFILE
+#define ABC_ALLOC(type, num)     ((type *) Abc_MemProfMalloc(sizeof(type) * (size_t)(num)))
+#define ABC_CALLOC(type, num)    ((type *) Abc_MemProfCalloc((size_t)(num), sizeof(type)))
+#define ABC_FALLOC(type, num)    ((type *) memset(Abc_MemProfMalloc(sizeof(type) * (size_t)(num)), 0xff, sizeof(type) * (size_t)(num)))
+#define ABC_FREE(obj)            ((obj) ? (Abc_MemProfFree((char *) (obj)), (obj) = 0) : 0)
+#define ABC_REALLOC(type, obj, num) \
+        ((type *) Abc_MemProfRealloc((char *)(obj), sizeof(type) * (size_t)(num)))
+#else
 #define ABC_ALLOC(type, num)     ((type *) malloc(sizeof(type) * (size_t)(num)))
 #define ABC_CALLOC(type, num)    ((type *) calloc((size_t)(num), sizeof(type)))
 #define ABC_FALLOC(type, num)    ((type *) memset(malloc(sizeof(type) * (size_t)(num)), 0xff, sizeof(type) * (size_t)(num)))
@@ -268,6 +297,7 @@ typedef ABC_INT64_T iword;
 #define ABC_REALLOC(type, obj, num) \
         ((obj) ? ((type *) realloc((char *)(obj), sizeof(type) * (size_t)(num))) : \
          ((type *) malloc(sizeof(type) * (size_t)(num))))
+#endif
 
 static inline int      Abc_AbsInt( int a        )             { return a < 0 ? -a : a; }
 static inline int      Abc_MaxInt( int a, int b )             { return a > b ?  a : b; }
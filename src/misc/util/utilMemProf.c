@@ -0,0 +1,259 @@
+/**CFile****************************************************************
+
+  FileName    [utilMemProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Memory profiling utilities.]
+
+  Synopsis    [Counters of allocated memory and peak RSS.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+
+#if defined(__GLIBC__) || defined(__linux__)
+#include <malloc.h>
+#define ABC_MEM_PROF_SIZE(p)   malloc_usable_size(p)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define ABC_MEM_PROF_SIZE(p)   malloc_size(p)
+#elif defined(_WIN32)
+#include <malloc.h>
+#define ABC_MEM_PROF_SIZE(p)   _msize(p)
+#endif
+
+#ifndef _WIN32
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the counters are updated from several threads without locking,
+// so the peak values may be slightly off in the multi-threaded code
+#if defined(__GNUC__) && !defined(__cplusplus)
+#define ABC_MEM_PROF_ADD(p, n)   __atomic_add_fetch(p, n, __ATOMIC_RELAXED)
+#else
+#define ABC_MEM_PROF_ADD(p, n)   ((*(p)) += (n))
+#endif
+
+typedef struct Abc_MemProf_t_ Abc_MemProf_t;
+struct Abc_MemProf_t_
+{
+    iword            nLive;      // the number of bytes currently in use
+    iword            nPeak;      // the max number of bytes in use since the last reset
+    iword            nPeakAll;   // the max number of bytes in use
+    iword            nBytes;     // the total number of bytes allocated
+    iword            nAllocs;    // the total number of allocations
+};
+
+static Abc_MemProf_t s_MemProf[ABC_MEM_PROF_NUM];
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Records the allocation (nBytes > 0) or deallocation.]
+
+  Description [The pool counters are also added to the total of all pools.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_MemProfUpdate( Abc_MemProf_t * p, iword nBytes, int fAlloc )
+{
+    iword nLive = ABC_MEM_PROF_ADD( &p->nLive, nBytes );
+    if ( fAlloc )
+    {
+        ABC_MEM_PROF_ADD( &p->nAllocs, 1 );
+        if ( nBytes > 0 )
+            ABC_MEM_PROF_ADD( &p->nBytes, nBytes );
+    }
+    if ( p->nPeak < nLive )
+        p->nPeak = nLive;
+    if ( p->nPeakAll < nLive )
+        p->nPeakAll = nLive;
+}
+void Abc_MemProfAdd( int iKind, iword nBytes )
+{
+    assert( iKind >= 0 && iKind < ABC_MEM_PROF_POOLS );
+    Abc_MemProfUpdate( s_MemProf + iKind, nBytes, nBytes > 0 );
+    if ( iKind != ABC_MEM_PROF_HEAP )
+        Abc_MemProfUpdate( s_MemProf + ABC_MEM_PROF_POOLS, nBytes, nBytes > 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the counters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_MemProfRead( int iKind, iword * pnLive, iword * pnPeak, iword * pnBytes, iword * pnAllocs )
+{
+    assert( iKind >= 0 && iKind < ABC_MEM_PROF_NUM );
+    if ( pnLive )   *pnLive   = s_MemProf[iKind].nLive;
+    if ( pnPeak )   *pnPeak   = s_MemProf[iKind].nPeak;
+    if ( pnBytes )  *pnBytes  = s_MemProf[iKind].nBytes;
+    if ( pnAllocs ) *pnAllocs = s_MemProf[iKind].nAllocs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restarts the peak from the current usage.]
+
+  Description [Returns the previous peak, which should be passed to
+  Abc_MemProfPeakRestore() to measure the peak of a nested interval.
+  The peak since the start of the process is not affected.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+iword Abc_MemProfPeakReset( int iKind )
+{
+    iword nPeak = s_MemProf[iKind].nPeak;
+    s_MemProf[iKind].nPeak = s_MemProf[iKind].nLive;
+    return nPeak;
+}
+void Abc_MemProfPeakRestore( int iKind, iword nPeak )
+{
+    if ( s_MemProf[iKind].nPeak < nPeak )
+        s_MemProf[iKind].nPeak = nPeak;
+}
+iword Abc_MemProfPeakTotal( int iKind )
+{
+    return s_MemProf[iKind].nPeakAll;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the heap allocations are counted.]
+
+  Description [This is the case when ABC is compiled with
+  ABC_USE_MEM_PROFILE, which redirects ABC_ALLOC() and friends into
+  the procedures below. The pool counters are always maintained.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_MemProfIsHeap( void )
+{
+#ifdef ABC_USE_MEM_PROFILE
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak resident set size of the process in bytes.]
+
+  Description [Returns 0 if the peak is not available on this platform.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+iword Abc_MemProfPeakRss( void )
+{
+#ifndef _WIN32
+    struct rusage ru;
+    if ( getrusage( RUSAGE_SELF, &ru ) < 0 )
+        return 0;
+#if defined(__APPLE__)
+    return (iword)ru.ru_maxrss;
+#else
+    return (iword)ru.ru_maxrss << 10;
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Instrumented heap allocation.]
+
+  Description [The block sizes are taken from the system allocator, so
+  the blocks allocated by ABC_ALLOC() and released by free() or, vice
+  versa, allocated elsewhere and released by ABC_FREE(), make the live
+  usage imprecise, but not incorrect.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline iword Abc_MemProfSize( void * p, size_t nBytes )
+{
+#ifdef ABC_MEM_PROF_SIZE
+    return p ? (iword)ABC_MEM_PROF_SIZE(p) : 0;
+#else
+    return p ? (iword)nBytes : 0;
+#endif
+}
+void * Abc_MemProfMalloc( size_t nBytes )
+{
+    void * p = malloc( nBytes );
+    Abc_MemProfUpdate( s_MemProf + ABC_MEM_PROF_HEAP, Abc_MemProfSize(p, nBytes), 1 );
+    return p;
+}
+void * Abc_MemProfCalloc( size_t nItems, size_t nSize )
+{
+    void * p = calloc( nItems, nSize );
+    Abc_MemProfUpdate( s_MemProf + ABC_MEM_PROF_HEAP, Abc_MemProfSize(p, nItems * nSize), 1 );
+    return p;
+}
+void * Abc_MemProfRealloc( void * p, size_t nBytes )
+{
+    iword nOld = Abc_MemProfSize( p, 0 );
+    p = realloc( p, nBytes );
+    Abc_MemProfUpdate( s_MemProf + ABC_MEM_PROF_HEAP, Abc_MemProfSize(p, nBytes) - nOld, 1 );
+    return p;
+}
+void Abc_MemProfFree( void * p )
+{
+#ifdef ABC_MEM_PROF_SIZE
+    Abc_MemProfUpdate( s_MemProf + ABC_MEM_PROF_HEAP, -Abc_MemProfSize(p, 0), 0 );
+#endif
+    free( p );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -112,7 +112,8 @@ p->timeGia += Abc_Clock() - clk;
     }
 */ 
     p->nSatCalls++;
-    RetValue = sat_solver_solve( p->pSat, pCands, pCands + nCands, (ABC_INT64_T)p->pPars->nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    // the candidates share the leading fanin literals, which stay on the trail between the calls
+    RetValue = sat_solver_solve_reuse( p->pSat, pCands, pCands + nCands, (ABC_INT64_T)p->pPars->nBTLimit, (ABC_INT64_T)0 );
 //    assert( RetValue == l_False || RetValue == l_True );
 
     if ( RetValue != l_Undef && RetValue2 != -1 )
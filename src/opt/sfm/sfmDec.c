@@ -842,7 +842,8 @@ int Sfm_DecPeformDec_rec( Sfm_Dec_t * p, word * pTruth, int * pSupp, int * pAssu
         p->nSatCalls++;
         pAssump[nAssump] = Abc_Var2Lit( p->iTarget, c );
         clk = Abc_Clock();
-        status = sat_solver_solve( p->pSat, pAssump, pAssump + nAssump + 1, nBTLimit, 0, 0, 0 );
+        // the cofactoring assumptions stay on the trail between the calls
+        status = sat_solver_solve_reuse( p->pSat, pAssump, pAssump + nAssump + 1, nBTLimit, 0 );
         if ( status == l_Undef )
         {
             p->nTimeOuts++;
@@ -903,7 +904,7 @@ int Sfm_DecPeformDec_rec( Sfm_Dec_t * p, word * pTruth, int * pSupp, int * pAssu
             else
             {
                 p->nSatCalls++;
-                status = sat_solver_solve( p->pSat, pAssump, pAssump + nAssump + 2, nBTLimit, 0, 0, 0 );
+                status = sat_solver_solve_reuse( p->pSat, pAssump, pAssump + nAssump + 2, nBTLimit, 0 );
             }
             if ( status == l_Undef )
             {
@@ -968,7 +969,7 @@ int Sfm_DecPeformDec_rec( Sfm_Dec_t * p, word * pTruth, int * pSupp, int * pAssu
         Vec_IntForEachEntry( &p->vImpls[!c], iLit, i )
             pAssump[nAssump+1+i] = iLit;
         clk = Abc_Clock();
-        status = sat_solver_solve( p->pSat, pAssump, pAssump + nAssump+1+i, nBTLimit, 0, 0, 0 );
+        status = sat_solver_solve_reuse( p->pSat, pAssump, pAssump + nAssump+1+i, nBTLimit, 0 );
         if ( status == l_Undef )
         {
             p->nTimeOuts++;
@@ -1793,8 +1794,8 @@ void Sfm_DecPrintStats( Sfm_Dec_t * p )
     int i;
     printf( "Node = %d. Try = %d. Change = %d.   Const0 = %d. Const1 = %d. Buf = %d. Inv = %d. Gate = %d. AndOr = %d. Effort = %d.  NoDec = %d.\n",
         p->nTotalNodesBeg, p->nNodesTried, p->nNodesChanged, p->nNodesConst0, p->nNodesConst1, p->nNodesBuf, p->nNodesInv, p->nNodesResyn, p->nNodesAndOr, p->nEfforts, p->nNoDecs );
-    printf( "MaxDiv = %d. MaxWin = %d.   AveDiv = %d. AveWin = %d.   Calls = %d. (Sat = %d. Unsat = %d.)  Over = %d.  T/O = %d.\n",
-        p->nMaxDivs, p->nMaxWin, (int)(p->nAllDivs/Abc_MaxInt(1, p->nNodesTried)), (int)(p->nAllWin/Abc_MaxInt(1, p->nNodesTried)), p->nSatCalls, p->nSatCallsSat, p->nSatCallsUnsat, p->nSatCallsOver, p->nTimeOuts );
+    printf( "MaxDiv = %d. MaxWin = %d.   AveDiv = %d. AveWin = %d.   Calls = %d. (Sat = %d. Unsat = %d.)  Over = %d.  Reused = %d.  T/O = %d.\n",
+        p->nMaxDivs, p->nMaxWin, (int)(p->nAllDivs/Abc_MaxInt(1, p->nNodesTried)), (int)(p->nAllWin/Abc_MaxInt(1, p->nNodesTried)), p->nSatCalls, p->nSatCallsSat, p->nSatCallsUnsat, p->nSatCallsOver, p->pSat->nAssumpReused, p->nTimeOuts );
 
     p->timeTotal = Abc_Clock() - p->timeStart;
     p->timeOther = p->timeTotal - p->timeLib - p->timeWin - p->timeCnf - p->timeSat - p->timeTime;
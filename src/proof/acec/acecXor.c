@@ -442,7 +442,7 @@ void Gia_ManTestXor( Gia_Man_t * p )
     Vec_Wrd_t * vSimsPi = Vec_WrdStartTruthTables( Gia_ManCiNum(p) );
     Vec_Wrd_t * vSims   = Gia_ManSimPatSimOut( p, vSimsPi, 1 );
     int n, i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(p);
-    Gia_Obj_t * pObj; Vec_Wrd_t * vSims2;
+    Gia_Obj_t * pObj; Vec_Wrd_t * vSims2 = Vec_WrdAlloc( 0 );
     Gia_ManForEachAnd( p, pObj, i )
     {
         Gia_Obj_t Obj = *pObj;
@@ -458,14 +458,14 @@ void Gia_ManTestXor( Gia_Man_t * p )
                 pObj->iDiff0 = pObj->iDiff1;
                 pObj->fCompl0 = pObj->fCompl1;
             }
-            vSims2 = Gia_ManSimPatSimOut( p, vSimsPi, 1 );
+            Gia_ManSimPatSimMt( p, vSimsPi, vSims2, 1, 1 );
             printf( "%2d %2d : %5d\n", i, n, Abc_TtCountOnesVecXor(Vec_WrdArray(vSims), Vec_WrdArray(vSims2), Vec_WrdSize(vSims2)) );
-            Vec_WrdFree( vSims2 );
             *pObj = Obj;
         }
     }
     Vec_WrdFree( vSimsPi );
     Vec_WrdFree( vSims );
+    Vec_WrdFree( vSims2 );
     nWords = 0;
 }
 
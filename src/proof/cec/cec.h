@@ -53,6 +53,7 @@ struct Cec_ParSat_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
     int              fSaveCexes;    // saves counter-examples
+    int              fUseService;   // solve through the shared SAT service
     int              fVerbose;      // verbose stats
 };
 
@@ -108,6 +109,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of threads for class refinement
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -123,6 +125,7 @@ struct Cec_ParFra_t_
     int              fBMiterInfo;   // printing BMiter information
     int              nPO;           // number of po in original design given a bmiter
     char *           pDumpName;     // file name to dump statistics
+    char *           pPatDbName;    // file name of the simulation pattern database
 };
 
 // combinational equivalence checking parameters
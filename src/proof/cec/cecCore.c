@@ -54,6 +54,7 @@ void Cec_ManSatSetDefaultParams( Cec_ParSat_t * p )
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fLearnCls      =       0;  // perform clause learning
+    p->fUseService    =       0;  // solve through the shared SAT service
     p->fVerbose       =       0;  // verbose stats
 }  
 
@@ -238,7 +239,9 @@ Gia_Man_t * Cec_ManSatSolving( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int f0Pro
     Gia_Man_t * pNew;
     Cec_ManPat_t * pPat;
     pPat = Cec_ManPatStart();
-    if ( pPars->SolverType == -1 )
+    if ( pPars->fUseService && Sat_ServiceGlobal() )
+        Cec_ManSatSolveService( pAig, pPars, f0Proved );
+    else if ( pPars->SolverType == -1 )
         Cec_ManSatSolve( pPat, pAig, pPars, NULL, NULL, NULL, f0Proved );
     else
         CecG_ManSatSolve( pPat, pAig, pPars, f0Proved );
@@ -20,11 +20,23 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilNam.h"
 #include "cec.h"
 #include "bdd/extrab/extraBdd.h"
 #include "base/abc/abc.h"
 #include "map/if/if.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -84,6 +96,23 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define CEC4_REF_SMALL       8    // classes up to this size are refined without hashing
+#define CEC4_REF_PAR_MIN  1000    // the min number of classes to be refined in parallel
+
+// thread-local refinement data
+typedef struct Cec4_RefTh_t_ Cec4_RefTh_t;
+struct Cec4_RefTh_t_
+{
+    Gia_Man_t *      p;              // user's AIG
+    Vec_Int_t *      vClasses;       // classes to refine
+    int              iThread;        // this thread
+    int              nThreads;       // the number of threads
+    Vec_Int_t *      vNodes;         // nodes of one class
+    Vec_Int_t *      vBins;          // used bins of the table
+    int *            pTable;         // hash table
+    int              nTableSize;     // hash table size
+};
+
 // SAT solving manager
 typedef struct Cec4_Man_t_ Cec4_Man_t;
 struct Cec4_Man_t_
@@ -114,6 +143,8 @@ struct Cec4_Man_t_
     Vec_Int_t *      vRefBins;
     int *            pTable;
     int              nTableSize;
+    Cec4_RefTh_t *   pRefTh;         // thread-local refinement data
+    int              nRefTh;         // the number of refinement threads
     // statistics
     int              nItersSim;
     int              nItersSat;
@@ -222,6 +253,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of threads for class refinement
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -300,6 +332,7 @@ Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
 }
 void Cec4_ManDestroy( Cec4_Man_t * p )
 {
+    int i;
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
@@ -346,6 +379,13 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vRefNodes );
     Vec_IntFreeP( &p->vRefBins );
     ABC_FREE( p->pTable );
+    for ( i = 0; i < p->nRefTh; i++ )
+    {
+        Vec_IntFreeP( &p->pRefTh[i].vNodes );
+        Vec_IntFreeP( &p->pRefTh[i].vBins );
+        ABC_FREE( p->pRefTh[i].pTable );
+    }
+    ABC_FREE( p->pRefTh );
     ABC_FREE( p );
 }
 Gia_Man_t * Cec4_ManStartNew( Gia_Man_t * pAig )
@@ -753,23 +793,23 @@ void Cec4_RefineOneClassIter( Gia_Man_t * p, int iRepr )
     if ( Gia_ObjNext(p, iRepr2) > 0 )
         Cec4_RefineOneClassIter( p, iRepr2 );
 }
-void Cec4_RefineOneClass( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vNodes )
+void Cec4_RefineOneClass( Gia_Man_t * p, int * pTable, int nTableSize, Vec_Int_t * vBins, Vec_Int_t * vNodes )
 {
     int k, iObj, Bin;
-    Vec_IntClear( pMan->vRefBins );
+    Vec_IntClear( vBins );
     Vec_IntForEachEntryReverse( vNodes, iObj, k )
     {
-        int Key = Cec4_ManSimHashKey( Cec4_ObjSim(p, iObj), p->nSimWords, pMan->nTableSize );
-        assert( Key >= 0 && Key < pMan->nTableSize );
-        if ( pMan->pTable[Key] == -1 )
-            Vec_IntPush( pMan->vRefBins, Key );
-        p->pNexts[iObj] = pMan->pTable[Key];
-        pMan->pTable[Key] = iObj;
-    }
-    Vec_IntForEachEntry( pMan->vRefBins, Bin, k )
+        int Key = Cec4_ManSimHashKey( Cec4_ObjSim(p, iObj), p->nSimWords, nTableSize );
+        assert( Key >= 0 && Key < nTableSize );
+        if ( pTable[Key] == -1 )
+            Vec_IntPush( vBins, Key );
+        p->pNexts[iObj] = pTable[Key];
+        pTable[Key] = iObj;
+    }
+    Vec_IntForEachEntry( vBins, Bin, k )
     {
-        int iRepr = pMan->pTable[Bin];
-        pMan->pTable[Bin] = -1;
+        int iRepr = pTable[Bin];
+        pTable[Bin] = -1;
         assert( p->pReprs[iRepr].iRepr == GIA_VOID );
         assert( p->pNexts[iRepr] != 0 );
         if ( p->pNexts[iRepr] == -1 )
@@ -778,32 +818,85 @@ void Cec4_RefineOneClass( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vNodes )
             p->pReprs[iObj].iRepr = iRepr;
         Cec4_RefineOneClassIter( p, iRepr );
     }
-    Vec_IntClear( pMan->vRefBins );
+    Vec_IntClear( vBins );
+}
+void Cec4_RefineClassesRange( Cec4_RefTh_t * pTh )
+{
+    Gia_Man_t * p = pTh->p;
+    int i, k, iObj, iRepr, nSize;
+    for ( i = pTh->iThread; i < Vec_IntSize(pTh->vClasses); i += pTh->nThreads )
+    {
+        iRepr = Vec_IntEntry( pTh->vClasses, i );
+        assert( p->pReprs[iRepr].fColorA );
+        p->pReprs[iRepr].fColorA = 0;
+        // small classes are split by comparing the nodes directly
+        nSize = 0;
+        Gia_ClassForEachObj1( p, iRepr, k )
+            if ( ++nSize > CEC4_REF_SMALL )
+                break;
+        if ( nSize <= CEC4_REF_SMALL )
+        {
+            Cec4_RefineOneClassIter( p, iRepr );
+            continue;
+        }
+        // large classes are split by hashing
+        Vec_IntClear( pTh->vNodes );
+        Vec_IntPush( pTh->vNodes, iRepr );
+        Gia_ClassForEachObj1( p, iRepr, k )
+            Vec_IntPush( pTh->vNodes, k );
+        Vec_IntForEachEntry( pTh->vNodes, iObj, k )
+        {
+            p->pReprs[iObj].iRepr = GIA_VOID;
+            p->pNexts[iObj] = -1;
+        }
+        Cec4_RefineOneClass( p, pTh->pTable, pTh->nTableSize, pTh->vBins, pTh->vNodes );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Cec4_RefineClassesThread( void * pArg )
+{
+    Cec4_RefineClassesRange( (Cec4_RefTh_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+#endif
+void Cec4_RefineClassesParallel( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vClasses )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[64];
+    int i, status;
+    assert( pMan->nRefTh > 1 && pMan->nRefTh <= 64 );
+    for ( i = 0; i < pMan->nRefTh; i++ )
+    {
+        pMan->pRefTh[i].vClasses = vClasses;
+        status = pthread_create( WorkerThread + i, NULL, Cec4_RefineClassesThread, (void *)(pMan->pRefTh + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < pMan->nRefTh; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#endif
 }
 void Cec4_RefineClasses( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vClasses )
 {
     if ( Vec_IntSize(pMan->vRefClasses) == 0 )
         return;
     if ( Vec_IntSize(pMan->vRefNodes) > 0 )
-        Cec4_RefineOneClass( p, pMan, pMan->vRefNodes );
+        Cec4_RefineOneClass( p, pMan->pTable, pMan->nTableSize, pMan->vRefBins, pMan->vRefNodes );
+    else if ( pMan->nRefTh > 1 && Vec_IntSize(pMan->vRefClasses) >= CEC4_REF_PAR_MIN )
+        Cec4_RefineClassesParallel( p, pMan, pMan->vRefClasses );
     else
     {
-        int i, k, iObj, iRepr;
-        Vec_IntForEachEntry( pMan->vRefClasses, iRepr, i )
-        {
-            assert( p->pReprs[iRepr].fColorA );
-            p->pReprs[iRepr].fColorA = 0;
-            Vec_IntClear( pMan->vRefNodes );
-            Vec_IntPush( pMan->vRefNodes, iRepr );
-            Gia_ClassForEachObj1( p, iRepr, k )
-                Vec_IntPush( pMan->vRefNodes, k );
-            Vec_IntForEachEntry( pMan->vRefNodes, iObj, k )
-            {
-                p->pReprs[iObj].iRepr = GIA_VOID;
-                p->pNexts[iObj] = -1;
-            }
-            Cec4_RefineOneClass( p, pMan, pMan->vRefNodes );
-        }
+        Cec4_RefTh_t Th;
+        Th.p          = p;
+        Th.vClasses   = pMan->vRefClasses;
+        Th.iThread    = 0;
+        Th.nThreads   = 1;
+        Th.vNodes     = pMan->vRefNodes;
+        Th.vBins      = pMan->vRefBins;
+        Th.pTable     = pMan->pTable;
+        Th.nTableSize = pMan->nTableSize;
+        Cec4_RefineClassesRange( &Th );
     }
     Vec_IntClear( pMan->vRefClasses );
     Vec_IntClear( pMan->vRefNodes );
@@ -827,6 +920,24 @@ void Cec4_RefineInit( Gia_Man_t * p, Cec4_Man_t * pMan )
     pMan->vRefBins    = Vec_IntAlloc( Gia_ManObjNum(p)/2 );
     pMan->vRefClasses = Vec_IntAlloc( Gia_ManObjNum(p)/2 );
     Vec_IntPush( pMan->vRefClasses, 0 );
+#ifdef ABC_USE_PTHREADS
+    // thread-local data for refining disjoint classes in parallel
+    if ( pMan->pPars->nProcs > 1 )
+    {
+        pMan->nRefTh = Abc_MinInt( pMan->pPars->nProcs, 64 );
+        pMan->pRefTh = ABC_CALLOC( Cec4_RefTh_t, pMan->nRefTh );
+        for ( i = 0; i < pMan->nRefTh; i++ )
+        {
+            pMan->pRefTh[i].p          = p;
+            pMan->pRefTh[i].iThread    = i;
+            pMan->pRefTh[i].nThreads   = pMan->nRefTh;
+            pMan->pRefTh[i].vNodes     = Vec_IntAlloc( 100 );
+            pMan->pRefTh[i].vBins      = Vec_IntAlloc( 100 );
+            pMan->pRefTh[i].nTableSize = Abc_PrimeCudd( Gia_ManObjNum(p) / pMan->nRefTh + 1 );
+            pMan->pRefTh[i].pTable     = ABC_FALLOC( int, pMan->pRefTh[i].nTableSize );
+        }
+    }
+#endif
 }
 
 
@@ -1858,12 +1969,283 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Pattern database.]
+
+  Description [The database keeps the simulation patterns that disproved 
+  candidate equivalences in the previous runs, so that the next run on 
+  the same or a similar design can refine the classes before SAT sweeping.
+  The binary file contains one record for each design, keyed by the 
+  structural signature of the AIG. A record stores the CI names (if 
+  available) and, for each pattern, only the CI literals assigned by it. 
+  The record with the same signature is loaded with the inputs matched 
+  by index. Otherwise, the most recent record is loaded with the inputs 
+  matched by name (or by index if the names are not available).  
+  The unassigned inputs get random values when the patterns are simulated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CEC4_PDB_MAGIC    "ABCPDB02"
+#define CEC4_PDB_REC_MAX  16       // the largest number of designs kept in the database
+#define CEC4_PDB_PAT_MAX  65536    // the largest number of patterns kept for one design
+#define CEC4_PDB_HEAD     5        // the record header: signature (two ints), CI count, name bytes, pattern ints
+
+static inline int *  Cec4_PatDbHead( Vec_Str_t * vRec )  { return (int *)Vec_StrArray(vRec);                                                  }
+static inline word   Cec4_PatDbSign( Vec_Str_t * vRec )  { word Sign; memcpy( &Sign, Vec_StrArray(vRec), sizeof(word) ); return Sign;        }
+static inline char * Cec4_PatDbNames( Vec_Str_t * vRec ) { return Vec_StrArray(vRec) + sizeof(int) * CEC4_PDB_HEAD;                          }
+static inline int *  Cec4_PatDbPats( Vec_Str_t * vRec )  { return (int *)(Cec4_PatDbNames(vRec) + Cec4_PatDbHead(vRec)[3]);                  }
+
+word Cec4_ManPatDbSignature( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj; int i;
+    word Sign = ABC_CONST(0xCBF29CE484222325);
+    Sign = (Sign ^ (word)Gia_ManCiNum(p)) * ABC_CONST(0x100000001B3);
+    Sign = (Sign ^ (word)Gia_ManCoNum(p)) * ABC_CONST(0x100000001B3);
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            Sign = (Sign ^ (word)Gia_ObjFaninLit0(pObj, i)) * ABC_CONST(0x100000001B3);
+            Sign = (Sign ^ (word)Gia_ObjFaninLit1(pObj, i)) * ABC_CONST(0x100000001B3);
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+            Sign = (Sign ^ (word)Gia_ObjFaninLit0(pObj, i)) * ABC_CONST(0x100000001B3);
+    }
+    return Sign;
+}
+void Cec4_ManPatDbFree( Vec_Ptr_t * vRecs )
+{
+    Vec_Str_t * vRec; int i;
+    if ( vRecs == NULL )
+        return;
+    Vec_PtrForEachEntry( Vec_Str_t *, vRecs, vRec, i )
+        Vec_StrFree( vRec );
+    Vec_PtrFree( vRecs );
+}
+Vec_Ptr_t * Cec4_ManPatDbRead( char * pFileName, int fVerbose )
+{
+    Vec_Ptr_t * vRecs;
+    Vec_Str_t * vRec;
+    char pMagic[8];
+    int i, nRecs, nBytes, pHead[CEC4_PDB_HEAD];
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        if ( fVerbose )
+            printf( "Pattern database \"%s\" does not exist and will be created.\n", pFileName );
+        return NULL;
+    }
+    if ( fread( pMagic, 1, 8, pFile ) != 8 || strncmp(pMagic, CEC4_PDB_MAGIC, 8) || fread( &nRecs, sizeof(int), 1, pFile ) != 1 || nRecs < 0 )
+    {
+        printf( "File \"%s\" is not a valid pattern database.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    vRecs = Vec_PtrAlloc( nRecs );
+    for ( i = 0; i < nRecs; i++ )
+    {
+        if ( fread( pHead, sizeof(int), CEC4_PDB_HEAD, pFile ) != CEC4_PDB_HEAD || pHead[2] < 0 || pHead[3] < 0 || pHead[3] % 4 || pHead[4] < 0 )
+            break;
+        nBytes = sizeof(int) * (CEC4_PDB_HEAD + pHead[4]) + pHead[3];
+        vRec = Vec_StrStart( nBytes );
+        memcpy( Vec_StrArray(vRec), pHead, sizeof(int) * CEC4_PDB_HEAD );
+        if ( fread( Cec4_PatDbNames(vRec), 1, nBytes - sizeof(int) * CEC4_PDB_HEAD, pFile ) != (size_t)(nBytes - sizeof(int) * CEC4_PDB_HEAD) )
+        {
+            Vec_StrFree( vRec );
+            break;
+        }
+        Vec_PtrPush( vRecs, vRec );
+    }
+    if ( i < nRecs )
+        printf( "File \"%s\" is truncated. Using %d (out of %d) records.\n", pFileName, i, nRecs );
+    fclose( pFile );
+    return vRecs;
+}
+int Cec4_ManPatDbLoad( Gia_Man_t * p, Vec_Ptr_t * vRecs, Vec_Int_t * vPats, int fVerbose )
+{
+    Vec_Str_t * vRec = NULL, * vTemp;
+    Vec_Int_t * vMap;
+    Abc_Nam_t * pNames;
+    word Sign = Cec4_ManPatDbSignature( p );
+    char * pName, * pLimit;
+    int i, k, c, iLit, iVar, iStart, * pHead, * pPats, nPats = 0, nMatched = 0, fExact = 0;
+    // prefer the record of this design; otherwise, take the most recent one
+    Vec_PtrForEachEntry( Vec_Str_t *, vRecs, vTemp, i )
+        if ( Cec4_PatDbSign(vTemp) == Sign )
+            vRec = vTemp, fExact = 1;
+    if ( vRec == NULL && Vec_PtrSize(vRecs) > 0 )
+        vRec = (Vec_Str_t *)Vec_PtrEntryLast( vRecs );
+    if ( vRec == NULL )
+        return 0;
+    // map the inputs of the record into the inputs of the current AIG
+    pHead = Cec4_PatDbHead( vRec );
+    vMap  = Vec_IntStartFull( pHead[2] );
+    if ( !fExact && pHead[3] > 0 && p->vNamesIn )
+    {
+        pNames = Abc_NamStart( Gia_ManCiNum(p), 20 );
+        for ( i = 0; i < Gia_ManCiNum(p); i++ )
+            Abc_NamStrFindOrAdd( pNames, Gia_ObjCiName(p, i), NULL );
+        pName  = Cec4_PatDbNames( vRec );
+        pLimit = pName + pHead[3];
+        for ( i = 0; i < pHead[2] && pName < pLimit && memchr(pName, 0, pLimit - pName); i++, pName += strlen(pName) + 1 )
+            if ( (c = Abc_NamStrFind(pNames, pName)) > 0 )
+                Vec_IntWriteEntry( vMap, i, c-1 ), nMatched++;
+        Abc_NamStop( pNames );
+    }
+    else if ( pHead[2] == Gia_ManCiNum(p) )
+    {
+        for ( i = 0; i < pHead[2]; i++ )
+            Vec_IntWriteEntry( vMap, i, i );
+        nMatched = pHead[2];
+    }
+    // translate the patterns, dropping the literals of the unmatched inputs
+    pPats = Cec4_PatDbPats( vRec );
+    for ( i = 0; nMatched > 0 && i < pHead[4] && pPats[i] >= 0 && i + pPats[i] < pHead[4]; i += pPats[i] + 1 )
+    {
+        iStart = Vec_IntSize( vPats );
+        Vec_IntPush( vPats, 0 );
+        for ( k = 1; k <= pPats[i]; k++ )
+        {
+            iLit = pPats[i+k];
+            iVar = Abc_Lit2Var( iLit );
+            if ( iLit >= 0 && iVar < pHead[2] && Vec_IntEntry(vMap, iVar) >= 0 )
+                Vec_IntPush( vPats, Abc_Var2Lit(Vec_IntEntry(vMap, iVar) + 1, Abc_LitIsCompl(iLit)) );
+        }
+        if ( Vec_IntSize(vPats) == iStart + 1 )
+        {
+            Vec_IntShrink( vPats, iStart );
+            continue;
+        }
+        Vec_IntPush( vPats, -1 );
+        Vec_IntWriteEntry( vPats, iStart, Vec_IntSize(vPats) - iStart );
+        nPats++;
+    }
+    if ( fVerbose )
+        printf( "Loaded %d patterns from the %s record. Matched %d (out of %d) inputs.\n", 
+            nPats, fExact ? "matching" : "most recent", nMatched, Gia_ManCiNum(p) );
+    Vec_IntFree( vMap );
+    return nPats;
+}
+int Cec4_ManPatDbAppend( Vec_Str_t * vRec, Vec_Int_t * vPats, int nSkip )
+{
+    int i, k, iLit, nLits, iPat = 0, nPats = 0;
+    for ( i = 0; vPats && i < Vec_IntSize(vPats); i += Vec_IntEntry(vPats, i), iPat++ )
+    {
+        if ( iPat < nSkip )
+            continue;
+        nLits = Vec_IntEntry(vPats, i) - 2;
+        Vec_StrPushBuffer( vRec, (char *)&nLits, sizeof(int) );
+        for ( k = 1; k <= nLits; k++ )
+        {
+            iLit = Vec_IntEntry(vPats, i+k);
+            assert( Abc_Lit2Var(iLit) > 0 );
+            iLit = Abc_Var2Lit( Abc_Lit2Var(iLit) - 1, Abc_LitIsCompl(iLit) );
+            Vec_StrPushBuffer( vRec, (char *)&iLit, sizeof(int) );
+        }
+        nPats++;
+    }
+    return nPats;
+}
+int Cec4_ManPatDbCount( Vec_Int_t * vPats )
+{
+    int i, nPats = 0;
+    for ( i = 0; vPats && i < Vec_IntSize(vPats); i += Vec_IntEntry(vPats, i) )
+        nPats++;
+    return nPats;
+}
+void Cec4_ManPatDbWrite( Gia_Man_t * p, char * pFileName, Vec_Ptr_t * vRecs, Vec_Int_t * vOld, Vec_Int_t * vNew, int fVerbose )
+{
+    Vec_Str_t * vRec, * vTemp;
+    word Sign = Cec4_ManPatDbSignature( p );
+    int i, nRecs = 0, nSkip = 0, nPats, nOld = Cec4_ManPatDbCount(vOld), nNew = Cec4_ManPatDbCount(vNew);
+    FILE * pFile;
+    if ( nOld + nNew == 0 )
+        return;
+    // start the record of this design
+    vRec = Vec_StrStart( sizeof(int) * CEC4_PDB_HEAD );
+    memcpy( Vec_StrArray(vRec), &Sign, sizeof(word) );
+    Cec4_PatDbHead(vRec)[2] = Gia_ManCiNum(p);
+    if ( p->vNamesIn )
+    {
+        for ( i = 0; i < Gia_ManCiNum(p); i++ )
+            Vec_StrPushBuffer( vRec, Gia_ObjCiName(p, i), strlen(Gia_ObjCiName(p, i))+1 );
+        while ( Vec_StrSize(vRec) % 4 )
+            Vec_StrPush( vRec, 0 );
+        Cec4_PatDbHead(vRec)[3] = Vec_StrSize(vRec) - sizeof(int) * CEC4_PDB_HEAD;
+    }
+    // keep the most recent patterns
+    if ( nOld + nNew > CEC4_PDB_PAT_MAX )
+        nSkip = nOld + nNew - CEC4_PDB_PAT_MAX;
+    nPats  = Cec4_ManPatDbAppend( vRec, vOld, nSkip );
+    nPats += Cec4_ManPatDbAppend( vRec, vNew, Abc_MaxInt(nSkip - nOld, 0) );
+    Cec4_PatDbHead(vRec)[4] = (Vec_StrSize(vRec) - sizeof(int) * CEC4_PDB_HEAD - Cec4_PatDbHead(vRec)[3]) / sizeof(int);
+    // the records of other designs go first, except the oldest ones
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing the pattern database.\n", pFileName );
+        Vec_StrFree( vRec );
+        return;
+    }
+    if ( vRecs )
+    {
+        Vec_PtrForEachEntry( Vec_Str_t *, vRecs, vTemp, i )
+            if ( Cec4_PatDbSign(vTemp) != Sign )
+                nRecs++;
+        nSkip = Abc_MaxInt( nRecs - (CEC4_PDB_REC_MAX - 1), 0 );
+        nRecs -= nSkip;
+    }
+    nRecs++;
+    fwrite( CEC4_PDB_MAGIC, 1, 8, pFile );
+    fwrite( &nRecs, sizeof(int), 1, pFile );
+    if ( vRecs )
+        Vec_PtrForEachEntry( Vec_Str_t *, vRecs, vTemp, i )
+            if ( Cec4_PatDbSign(vTemp) != Sign && nSkip-- <= 0 )
+                fwrite( Vec_StrArray(vTemp), 1, Vec_StrSize(vTemp), pFile );
+    fwrite( Vec_StrArray(vRec), 1, Vec_StrSize(vRec), pFile );
+    fclose( pFile );
+    if ( fVerbose )
+        printf( "Written %d patterns (%d new) for %d inputs into pattern database \"%s\" with %d records.\n", 
+            nPats, Abc_MinInt(nNew, nPats), Gia_ManCiNum(p), pFileName, nRecs );
+    Vec_StrFree( vRec );
+}
+int Cec4_ManPatDbSimulate( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Int_t * vPats, int nPats )
+{
+    int nWords = Abc_Bit6WordNum( nPats );
+    Vec_Wrd_t * vSimsPi = Cec4_EvalCombine( vPats, nPats, Gia_ManCiNum(p), nWords );
+    int i, k, w, Id, RetValue = 1;
+    for ( w = 0; w < nWords; w += p->nSimWords )
+    {
+        Gia_ManForEachCiId( p, Id, i )
+        {
+            word * pSim = Cec4_ObjSim( p, Id );
+            word * pPat = Vec_WrdEntryP( vSimsPi, i * nWords );
+            for ( k = 0; k < p->nSimWords; k++ )
+                pSim[k] = w + k < nWords ? pPat[w + k] : Abc_RandomW(0);
+        }
+        p->iPatsPi = 0;
+        Cec4_ManSimulate( p, pMan );
+        if ( pMan->pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
+        {
+            RetValue = 0;
+            break;
+        }
+    }
+    Vec_WrdFree( vSimsPi );
+    return RetValue;
+}
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
-    int i, fSimulate = 1, Id;
+    Vec_Ptr_t * vPatDb = NULL;
+    Vec_Int_t * vPatDbPats = NULL;
+    int i, fSimulate = 1, Id, nPatDbPats = 0, fOwnPats = 0;
     if ( pPars->fVerbose )
         printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
             pPars->jType, pPars->nWords, pPars->nRounds, pPars->nBTLimit, pPars->nCallsRecycle );
@@ -1872,6 +2254,17 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Gia_ManForEachCi( p, pObj, i )
         assert( Gia_ObjId(p, pObj) == i+1 );
 
+    // load the pattern database and start recording the new patterns
+    if ( pPars->pPatDbName )
+    {
+        vPatDb = Cec4_ManPatDbRead( pPars->pPatDbName, pPars->fVerbose );
+        vPatDbPats = Vec_IntAlloc( 1000 );
+        if ( vPatDb )
+            nPatDbPats = Cec4_ManPatDbLoad( p, vPatDb, vPatDbPats, pPars->fVerbose );
+        if ( p->vPats == NULL )
+            p->vPats = Vec_IntAlloc( 1000 ), fOwnPats = 1;
+    }
+
     // check if any output trivially fails under all-0 pattern
     Abc_Random( 1 );
     Gia_ManSetPhase( p );
@@ -1899,6 +2292,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         Cec4_ManSimulate( p, pMan );
         if ( pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
           goto finalize;
+        if ( nPatDbPats && !Cec4_ManPatDbSimulate( p, pMan, vPatDbPats, nPatDbPats ) )
+          goto finalize;
         if ( fSimOnly )
           goto finalize;
         goto execute_sat;
@@ -1923,6 +2318,14 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         if ( i && i % (pPars->nRounds / 5) == 0 && pPars->fVerbose )
             Cec4_ManPrintStats( p, pPars, pMan, 1 );
     }
+    // simulate the patterns from the database
+    if ( nPatDbPats )
+    {
+        if ( !Cec4_ManPatDbSimulate( p, pMan, vPatDbPats, nPatDbPats ) )
+            goto finalize;
+        if ( pPars->fVerbose )
+            Cec4_ManPrintStats( p, pPars, pMan, 1 );
+    }
     if ( fSimOnly )
         goto finalize;
 
@@ -2048,6 +2451,12 @@ finalize:
     }
     if ( pPars->pDumpName )
         Cec4_ManSimulateDumpInfo( pMan );
+    if ( pPars->pPatDbName )
+        Cec4_ManPatDbWrite( p, pPars->pPatDbName, vPatDb, vPatDbPats, p->vPats, pPars->fVerbose );
+    if ( fOwnPats )
+        Vec_IntFreeP( &p->vPats );
+    Vec_IntFreeP( &vPatDbPats );
+    Cec4_ManPatDbFree( vPatDb );
     Cec4_ManDestroy( pMan );
     //Gia_ManStaticFanoutStop( p );
     //Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/cnf/cnf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -779,6 +780,86 @@ clk2 = Abc_Clock();
     Cec_ManSatStop( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the POs of the AIG using the shared SAT service.]
+
+  Description [Submits the CNF of the AIG once and one job per PO, which
+  asserts the PO. The jobs are solved by the workers of the service, which
+  reuse the solver for the jobs over the same CNF. The outputs are labeled
+  and the counter-examples are saved in the same way as Cec_ManSatSolve().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolveService( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int f0Proved )
+{
+    Sat_Service_t * pServ = Sat_ServiceGlobal();
+    Vec_Int_t * vJobs = Vec_IntStartFull( Gia_ManCoNum(pAig) );
+    Cnf_Dat_t * pCnf;
+    Gia_Obj_t * pObj, * pCi;
+    int i, k, iCnf, Lit, status, nCounts[3] = {0};
+    abctime clk = Abc_Clock();
+    assert( pServ != NULL );
+    Vec_PtrFreeP( &pAig->vSeqModelVec );
+    if ( pPars->fSaveCexes )
+        pAig->vSeqModelVec = Vec_PtrStart( Gia_ManCoNum(pAig) );
+    pCnf = (Cnf_Dat_t *)Gia_ManCnfDeriveFast( pAig, 0, 0, 0 );
+    iCnf = Sat_ServiceAddCnf( pServ, pCnf->nVars, pCnf->nClauses, pCnf->pClauses );
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+            continue;
+        Lit = Abc_Var2Lit( pCnf->pVarNums[Gia_ObjId(pAig, pObj)], 0 );
+        Vec_IntWriteEntry( vJobs, i, Sat_ServiceSubmit(pServ, iCnf, &Lit, 1, pPars->nBTLimit) );
+    }
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+            status = !Gia_ObjFaninC0(pObj);
+        else // convert into the status used by Cec_ManSatCheckNode()
+        {
+            status = Sat_ServiceWait( pServ, Vec_IntEntry(vJobs, i) );
+            status = status == 1 ? 0 : (status == -1 ? 1 : -1);
+        }
+        nCounts[status+1]++;
+        pObj->fMark0 = (status == 0);
+        pObj->fMark1 = (status == 1);
+        if ( pPars->fSaveCexes && status == 1 )
+            Vec_PtrWriteEntry( pAig->vSeqModelVec, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+        else if ( pPars->fSaveCexes && status == 0 )
+        {
+            Abc_Cex_t * pCex = Abc_CexAlloc( 0, Gia_ManCiNum(pAig), 1 );
+            pCex->iPo = i;
+            pCex->iFrame = 0;
+            if ( Vec_IntEntry(vJobs, i) >= 0 )
+                Gia_ManForEachCi( pAig, pCi, k )
+                    if ( pCnf->pVarNums[Gia_ObjId(pAig, pCi)] >= 0 && Sat_ServiceValue(pServ, Vec_IntEntry(vJobs, i), pCnf->pVarNums[Gia_ObjId(pAig, pCi)]) )
+                        Abc_InfoSetBit( pCex->pData, k );
+            Vec_PtrWriteEntry( pAig->vSeqModelVec, i, pCex );
+        }
+        if ( f0Proved && status == 1 )
+            Gia_ManPatchCoDriver( pAig, i, 0 );
+        // quit if one of them is solved
+        if ( pPars->fCheckMiter && status == 0 )
+        {
+            Sat_ServiceCancel( pServ, iCnf );
+            break;
+        }
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Solved %d outputs using the SAT service: Proved = %d. Disproved = %d. Undecided = %d.  ", 
+            nCounts[0] + nCounts[1] + nCounts[2], nCounts[2], nCounts[1], nCounts[0] );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        Sat_ServicePrintStats( pServ );
+    }
+    Cnf_DataFree( pCnf );
+    Vec_IntFree( vJobs );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one round of solving for the POs of the AIG.]
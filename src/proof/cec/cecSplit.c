@@ -24,6 +24,8 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/vec/vecQue.h"
+#include "misc/vec/vecWec.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -46,7 +48,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubes, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -737,7 +739,405 @@ finish:
     }
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+/**Function*************************************************************
+
+  Synopsis    [Estimates the size of the cofactor w.r.t. the cube.]
+
+  Description [Performs ternary constant propagation of the cube and returns 
+  the number of AND nodes whose value remains undecided. The cube is given 
+  as PI literals; a complemented literal stands for value 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaCncCubeCost( Gia_Man_t * p, Vec_Int_t * vCube, Vec_Str_t * vVals )
+{
+    Gia_Obj_t * pObj;
+    char * pVals;
+    int i, iLit, Val0, Val1, Cost = 0;
+    Vec_StrFill( vVals, Gia_ManObjNum(p), 2 );
+    pVals = Vec_StrArray( vVals );
+    pVals[0] = 0;
+    Vec_IntForEachEntry( vCube, iLit, i )
+        pVals[Gia_ManCiIdToId(p, Abc_Lit2Var(iLit))] = (char)!Abc_LitIsCompl(iLit);
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Val0 = pVals[Gia_ObjFaninId0(pObj, i)];
+        Val1 = pVals[Gia_ObjFaninId1(pObj, i)];
+        if ( Val0 < 2 ) Val0 ^= Gia_ObjFaninC0(pObj);
+        if ( Val1 < 2 ) Val1 ^= Gia_ObjFaninC1(pObj);
+        if ( Val0 == 0 || Val1 == 0 )
+            pVals[i] = 0;
+        else if ( Val0 == 1 && Val1 == 1 )
+            pVals[i] = 1;
+        else
+            pVals[i] = 2, Cost++;
+    }
+    return Cost;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the splitting variable for the cube by look-ahead.]
+
+  Description [Tries up to LookAhead PIs with the largest fanout that are not 
+  yet assigned in the cube and returns the one minimizing the total size of 
+  the two cofactors. The costs of the two cofactors are returned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaCncSplitVar( Gia_Man_t * p, int * pOrder, Vec_Int_t * vCube, int LookAhead, Vec_Str_t * vVals, Vec_Int_t * vMarks, int * pCost0, int * pCost1 )
+{
+    int i, k, iLit, iVar, Cost0, Cost1, nTried = 0, iBest = -1, CostBest = ABC_INFINITY;
+    Vec_IntForEachEntry( vCube, iLit, i )
+        Vec_IntWriteEntry( vMarks, Abc_Lit2Var(iLit), 1 );
+    for ( k = 0; k < Gia_ManPiNum(p) && nTried < LookAhead; k++ )
+    {
+        iVar = pOrder[k];
+        if ( Vec_IntEntry(vMarks, iVar) )
+            continue;
+        if ( Gia_ObjRefNum(p, Gia_ManPi(p, iVar)) == 0 )
+            break;
+        nTried++;
+        Vec_IntPush( vCube, Abc_Var2Lit(iVar, 1) );
+        Cost0 = Cec_GiaCncCubeCost( p, vCube, vVals );
+        Vec_IntWriteEntry( vCube, Vec_IntSize(vCube)-1, Abc_Var2Lit(iVar, 0) );
+        Cost1 = Cec_GiaCncCubeCost( p, vCube, vVals );
+        Vec_IntPop( vCube );
+        if ( CostBest > Cost0 + Cost1 )
+            CostBest = Cost0 + Cost1, iBest = iVar, *pCost0 = Cost0, *pCost1 = Cost1;
+    }
+    Vec_IntForEachEntry( vCube, iLit, i )
+        Vec_IntWriteEntry( vMarks, Abc_Lit2Var(iLit), 0 );
+    return iBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generates balanced cubes by look-ahead.]
+
+  Description [Starting from the empty cube, repeatedly splits the cube 
+  with the largest estimated cofactor until the given number of cubes 
+  is reached or no cube can be split further. Returns the array of cubes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Cec_GiaCncGenerateCubes( Gia_Man_t * p, int * pOrder, int nCubes, int LookAhead )
+{
+    Vec_Wec_t * vCubes = Vec_WecAlloc( 2 * nCubes );
+    Vec_Flt_t * vCosts = Vec_FltAlloc( 2 * nCubes );
+    Vec_Que_t * vQue   = Vec_QueAlloc( 2 * nCubes );
+    Vec_Int_t * vLeaves = Vec_IntAlloc( nCubes );
+    Vec_Int_t * vMarks = Vec_IntStart( Gia_ManPiNum(p) );
+    Vec_Str_t * vVals  = Vec_StrAlloc( Gia_ManObjNum(p) );
+    Vec_Wec_t * vRes;
+    Vec_Int_t * vCube, * vChild;
+    int i, iCube, iVar, Cost0, Cost1;
+    Vec_QueSetPriority( vQue, Vec_FltArrayP(vCosts) );
+    Vec_WecPushLevel( vCubes );
+    Vec_FltPush( vCosts, Gia_ManAndNum(p) );
+    Vec_QuePush( vQue, 0 );
+    while ( Vec_QueSize(vQue) > 0 && Vec_QueSize(vQue) + Vec_IntSize(vLeaves) < nCubes )
+    {
+        iCube = Vec_QuePop( vQue );
+        vCube = Vec_WecEntry( vCubes, iCube );
+        iVar  = Vec_FltEntry(vCosts, iCube) > 0 ? Cec_GiaCncSplitVar( p, pOrder, vCube, LookAhead, vVals, vMarks, &Cost0, &Cost1 ) : -1;
+        if ( iVar == -1 )
+        {
+            Vec_IntPush( vLeaves, iCube );
+            continue;
+        }
+        for ( i = 0; i < 2; i++ )
+        {
+            vChild = Vec_WecPushLevel( vCubes );
+            vCube  = Vec_WecEntry( vCubes, iCube );
+            Vec_IntAppend( vChild, vCube );
+            Vec_IntPush( vChild, Abc_Var2Lit(iVar, !i) );
+            Vec_FltPush( vCosts, i ? Cost1 : Cost0 );
+            Vec_QuePush( vQue, Vec_WecSize(vCubes)-1 );
+        }
+    }
+    while ( Vec_QueSize(vQue) > 0 )
+        Vec_IntPush( vLeaves, Vec_QuePop(vQue) );
+    // collect the leaves, the largest cubes first
+    vRes = Vec_WecAlloc( Vec_IntSize(vLeaves) );
+    Vec_IntForEachEntry( vLeaves, iCube, i )
+        Vec_IntAppend( Vec_WecPushLevel(vRes), Vec_WecEntry(vCubes, iCube) );
+    Vec_WecFree( vCubes );
+    Vec_FltFree( vCosts );
+    Vec_QueFree( vQue );
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vMarks );
+    Vec_StrFree( vVals );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer.]
+
+  Description [The cubes are kept in a shared pool. Each worker owns a solver
+  loaded with the CNF of the miter once and solves the cubes taken from the
+  pool incrementally under assumptions. Learned units and the final conflict 
+  clauses of UNSAT cubes are shared through an append-only clause buffer.
+  A cube that exceeds the runtime limit is split again by look-ahead and 
+  its two halves are returned to the pool.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CNC_SHARE_MAX 8
+typedef struct Cec_CncMan_t_ Cec_CncMan_t;
+struct Cec_CncMan_t_
+{
+    Gia_Man_t *     p;          // single-output miter
+    Cnf_Dat_t *     pCnf;       // its CNF
+    int *           pOrder;     // PIs in the order of decreasing fanout
+    Vec_Wec_t *     vCubes;     // cubes (PI literals)
+    Vec_Int_t *     vPool;      // cubes waiting to be solved
+    Vec_Int_t *     vShared;    // shared clauses (size followed by SAT literals)
+    pthread_mutex_t Mutex;      // protects the data above and below
+    pthread_cond_t  Cond;       // signals changes of the pool
+    int             nBusy;      // the number of workers solving a cube
+    int             fStop;      // the problem is solved (also polled by the solvers)
+    int             Result;     // the result (0 = SAT, 1 = UNSAT, -1 = undecided)
+    int             nUndec;     // cubes that could not be split further
+    Abc_Cex_t *     pCex;       // counter-example
+    // parameters
+    int             nTimeOut;   // runtime limit per cube
+    int             nIterMax;   // the max number of re-splits
+    int             LookAhead;  // look-ahead during splitting
+    int             fVerbose;   // verbose
+    // statistics
+    int             nSolved;    // solved cubes
+    int             nSplits;    // re-split cubes
+    int             nSharedCla; // shared clauses
+};
+typedef struct Cec_CncThData_t_
+{
+    Cec_CncMan_t *  pMan;
+    int             iThread;
+    int             nConfs;
+} Cec_CncThData_t;
+static inline void Cec_GiaCncShareClause( Cec_CncMan_t * p, int * pLits, int nLits )
+{
+    int i;
+    Vec_IntPush( p->vShared, nLits );
+    for ( i = 0; i < nLits; i++ )
+        Vec_IntPush( p->vShared, pLits[i] );
+    p->nSharedCla++;
+}
+void * Cec_GiaCncWorkerThread( void * pArg )
+{
+    Cec_CncThData_t * pThData = (Cec_CncThData_t *)pArg;
+    Cec_CncMan_t * p = pThData->pMan;
+    Vec_Int_t * vCube   = Vec_IntAlloc( 100 );
+    Vec_Int_t * vAssump = Vec_IntAlloc( 100 );
+    Vec_Int_t * vImport = Vec_IntAlloc( 100 );
+    Vec_Int_t * vMarks  = Vec_IntStart( Gia_ManPiNum(p->p) );
+    Vec_Str_t * vVals   = Vec_StrAlloc( Gia_ManObjNum(p->p) );
+    sat_solver * pSat   = Cec_GiaDeriveSolver( p->p, p->pCnf, 0 );
+    int i, k, iLit, iShared = 0, status, fSplit, * pFinal, nFinal;
+    if ( pSat )
+        sat_solver_set_stop( pSat, &p->fStop );
+    while ( 1 )
+    {
+        // take the next cube from the pool
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fStop && Vec_IntSize(p->vPool) == 0 && p->nBusy > 0 )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop || Vec_IntSize(p->vPool) == 0 || pSat == NULL )
+        {
+            if ( pSat == NULL ) // the CNF is UNSAT without assumptions
+                p->fStop = 1, p->Result = 1;
+            pthread_cond_broadcast( &p->Cond );
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        Vec_IntClear( vCube );
+        Vec_IntAppend( vCube, Vec_WecEntry(p->vCubes, Vec_IntPop(p->vPool)) );
+        Vec_IntClear( vImport );
+        for ( i = iShared; i < Vec_IntSize(p->vShared); i++ )
+            Vec_IntPush( vImport, Vec_IntEntry(p->vShared, i) );
+        iShared = Vec_IntSize(p->vShared);
+        fSplit  = !p->nIterMax || p->nSplits < p->nIterMax;
+        p->nBusy++;
+        pthread_mutex_unlock( &p->Mutex );
+        // import the clauses shared by other workers
+        status = l_Undef;
+        for ( i = 0; i < Vec_IntSize(vImport); i += Vec_IntEntry(vImport, i) + 1 )
+            if ( !sat_solver_addclause( pSat, Vec_IntArray(vImport) + i + 1, Vec_IntArray(vImport) + i + 1 + Vec_IntEntry(vImport, i) ) )
+                status = l_False;
+        // solve the cube
+        if ( status == l_Undef )
+        {
+            Vec_IntClear( vAssump );
+            Vec_IntForEachEntry( vCube, iLit, i )
+                if ( p->pCnf->pVarNums[Gia_ManCiIdToId(p->p, Abc_Lit2Var(iLit))] >= 0 )
+                    Vec_IntPush( vAssump, Abc_Var2Lit(p->pCnf->pVarNums[Gia_ManCiIdToId(p->p, Abc_Lit2Var(iLit))], Abc_LitIsCompl(iLit)) );
+            sat_solver_set_runtime_limit( pSat, p->nTimeOut ? p->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+            status = sat_solver_solve( pSat, Vec_IntArray(vAssump), Vec_IntLimit(vAssump), (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            pThData->nConfs = sat_solver_nconflicts( pSat );
+            if ( status == l_False && sat_solver_final(pSat, &pFinal) == 0 )
+                Vec_IntClear( vCube ); // UNSAT without assumptions
+        }
+        else
+            Vec_IntClear( vCube );
+        // split the undecided cube before taking the lock
+        if ( status == l_Undef )
+        {
+            int Cost0, Cost1, iVar = -1;
+            if ( fSplit )
+                iVar = Cec_GiaCncSplitVar( p->p, p->pOrder, vCube, p->LookAhead, vVals, vMarks, &Cost0, &Cost1 );
+            pthread_mutex_lock( &p->Mutex );
+            if ( p->fStop || (p->nIterMax && p->nSplits >= p->nIterMax) ) // solved or out of re-splits meanwhile
+                iVar = -1;
+            if ( iVar == -1 )
+                p->nUndec++;
+            else
+            {
+                for ( k = 0; k < 2; k++ )
+                {
+                    Vec_Int_t * vChild = Vec_WecPushLevel( p->vCubes );
+                    Vec_IntAppend( vChild, vCube );
+                    Vec_IntPush( vChild, Abc_Var2Lit(iVar, !k) );
+                    Vec_IntPush( p->vPool, Vec_WecSize(p->vCubes)-1 );
+                }
+                p->nSplits++;
+            }
+        }
+        else
+            pthread_mutex_lock( &p->Mutex );
+        // record the result
+        if ( status == l_True && !p->fStop )
+        {
+            p->pCex = Cec_SplitDeriveModel( p->p, p->pCnf, pSat );
+            p->Result = 0;
+            p->fStop = 1;
+        }
+        else if ( status == l_False && !p->fStop )
+        {
+            p->nSolved++;
+            if ( Vec_IntSize(vCube) == 0 )
+                p->Result = 1, p->fStop = 1;
+            else
+            {
+                // share the learned units and the clause blocking this cube
+                int iStart = Vec_IntSize(p->vShared);
+                nFinal = sat_solver_final( pSat, &pFinal );
+                if ( nFinal <= CNC_SHARE_MAX )
+                    Cec_GiaCncShareClause( p, pFinal, nFinal );
+                for ( k = 0; k < veci_size(&pSat->unit_lits); k++ )
+                    Cec_GiaCncShareClause( p, veci_begin(&pSat->unit_lits) + k, 1 );
+                // skip own clauses unless those of other workers are pending
+                if ( iShared == iStart )
+                    iShared = Vec_IntSize(p->vShared);
+            }
+        }
+        p->nBusy--;
+        pthread_cond_broadcast( &p->Cond );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    if ( pSat ) sat_solver_delete( pSat );
+    Vec_IntFree( vCube );
+    Vec_IntFree( vAssump );
+    Vec_IntFree( vImport );
+    Vec_IntFree( vMarks );
+    Vec_StrFree( vVals );
+    return NULL;
+}
+int Cec_GiaCubeAndConquer( Gia_Man_t * pGia, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubes, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    abctime clkTotal = Abc_Clock();
+    Cec_CncThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Cec_CncMan_t Man, * p = &Man;
+    int i, status;
+    assert( Gia_ManPoNum(pGia) == 1 );
+    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    Abc_CexFreeP( &pGia->pCexComb );
+    memset( p, 0, sizeof(Cec_CncMan_t) );
+    p->p         = pGia;
+    p->nTimeOut  = nTimeOut;
+    p->nIterMax  = nIterMax;
+    p->LookAhead = LookAhead;
+    p->fVerbose  = fVerbose;
+    p->Result    = -1;
+    p->pOrder    = Gia_PermuteSpecialOrder( pGia );
+    p->pCnf      = Cec_GiaDeriveGiaRemapped( pGia );
+    p->vShared   = Vec_IntAlloc( 1000 );
+    // lookahead phase
+    p->vCubes    = Cec_GiaCncGenerateCubes( pGia, p->pOrder, nCubes, LookAhead );
+    p->vPool     = Vec_IntStartNatural( Vec_WecSize(p->vCubes) );
+    Vec_IntReverseOrder( p->vPool );
+    if ( fVerbose )
+    {
+        printf( "Solving CEC problem by cube-and-conquer with %d workers and %d cubes (max depth %d).  ", 
+            nProcs, Vec_WecSize(p->vCubes), Vec_WecMaxLevelSize(p->vCubes) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    // conquer phase
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan    = p;
+        ThData[i].iThread = i;
+        ThData[i].nConfs  = 0;
+        status = pthread_create( WorkerThread + i, NULL, Cec_GiaCncWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+    if ( p->Result == -1 && !p->nUndec && Vec_IntSize(p->vPool) == 0 )
+        p->Result = 1;
+    pGia->pCexComb = p->pCex;
+    if ( fVeryVerbose )
+        for ( i = 0; i < nProcs; i++ )
+            printf( "Worker %2d : Conflicts = %10d.\n", i, ThData[i].nConfs );
+    if ( !fSilent )
+    {
+        if ( p->Result == 0 )
+            printf( "Problem is SAT " );
+        else if ( p->Result == 1 )
+            printf( "Problem is UNSAT " );
+        else
+            printf( "Problem is UNDECIDED " );
+        printf( "after proving %d cubes UNSAT with %d re-splits and %d shared clauses.  ", p->nSolved, p->nSplits, p->nSharedCla );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        fflush( stdout );
+    }
+    Cnf_DataFree( p->pCnf );
+    Vec_WecFree( p->vCubes );
+    Vec_IntFree( p->vPool );
+    Vec_IntFree( p->vShared );
+    ABC_FREE( p->pOrder );
+    return p->Result;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nCubes, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
@@ -749,8 +1149,10 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        if ( nCubes )
+            RetValue1 = Cec_GiaCubeAndConquer( pOne, nProcs, nTimeOut, nIterMax, LookAhead, nCubes, fVerbose, fVeryVerbose, fSilent );
+        else
+            RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +1160,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
@@ -60,6 +60,7 @@ struct Inter_ManParams_t_
     int  fCheckKstep;   // check using K-step induction
     int  fUseBias;      // bias decisions to global variables
     int  fUseBackward;  // perform backward interpolation
+    int  fUseStream;    // stream learned clauses into a trace file
     int  fUseSeparate;  // solve each output separately
     int  fUseTwoFrames; // create the OR of two last timeframes
     int  fDropSatOuts;  // replace by 1 the solved outputs
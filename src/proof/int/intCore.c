@@ -58,6 +58,7 @@ void Inter_ManSetDefaultParams( Inter_ManParams_t * p )
     p->fCheckKstep   = 1;     // check using K-step induction
     p->fUseBias      = 0;     // bias decisions to global variables
     p->fUseBackward  = 0;     // perform backward interpolation
+    p->fUseStream    = 0;     // stream learned clauses into a trace file
     p->fUseSeparate  = 0;     // solve each output separately
     p->fUseTwoFrames = 0;     // create OR of two last timeframes
     p->fDropSatOuts  = 0;     // replace by 1 the solved outputs
@@ -68,6 +68,7 @@ struct Inter_Man_t_
     int              nFrames;      // the number of timeframes
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
+    int              fUseStream;   // stream learned clauses into a trace file
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
     // runtime
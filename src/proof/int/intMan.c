@@ -51,6 +51,7 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     memset( p, 0, sizeof(Inter_Man_t) );
     p->vVarsAB = Vec_IntAlloc( Aig_ManRegNum(pAig) );
     p->nConfLimit = pPars->nBTLimit;
+    p->fUseStream = pPars->fUseStream;
     p->fVerbose = pPars->fVerbose;
     p->pFileName = pPars->pFileName;
     p->pAig = pAig;
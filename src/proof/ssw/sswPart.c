@@ -64,14 +64,21 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
+void Ssw_SignalCorrespondenceSetCorPars( Ssw_Pars_t * pPars, Cec_ParCor_t * pCorPars )
+{
+    Cec_ManCorSetDefaultParams( pCorPars );
+    pCorPars->nFrames    = pPars->nFramesK;
+    pCorPars->nBTLimit   = pPars->nBTLimit;
+    pCorPars->fLatchCorr = pPars->fLatchCorr;
+    pCorPars->fConstCorr = pPars->fConstCorr;
+    pCorPars->fVerbose   = pPars->fVerbose;
+    pCorPars->fUseCSat   = 1; 
+}
 void Ssw_SignalCorrespondenceArray1( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
 {
     Gia_Man_t * pGia; int i;
     Cec_ParCor_t CorPars, * pCorPars = &CorPars;
-    Cec_ManCorSetDefaultParams( pCorPars );
-    pCorPars->nBTLimit  = pPars->nBTLimit;
-    pCorPars->fVerbose  = pPars->fVerbose;
-    pCorPars->fUseCSat  = 1; 
+    Ssw_SignalCorrespondenceSetCorPars( pPars, pCorPars );
     Vec_PtrForEachEntry( Gia_Man_t *, vGias, pGia, i )
         if ( Gia_ManPiNum(pGia) > 0 )
             Cec_ManLSCorrespondenceClasses( pGia, pCorPars );
@@ -141,7 +148,7 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
     int i, status, nProcs = pPars->nProcs;
     Vec_Ptr_t * vStack;
     Cec_ParCor_t CorPars, * pCorPars = &CorPars;
-    Cec_ManCorSetDefaultParams( pCorPars );
+    Ssw_SignalCorrespondenceSetCorPars( pPars, pCorPars );
     if ( pPars->fVerbose )
         printf( "Running concurrent &scorr with %d processes.\n", nProcs );
     fflush( stdout );
@@ -227,6 +234,9 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         Abc_Print( 1, "Cannot use partitioned computation with constraints.\n" );
         return NULL;
     }
+    // prove partitions concurrently
+    if ( pPars->nProcs > 1 && !pPars->fLatchCorrOpt )
+        return Ssw_SignalCorrespondencePart2( pAig, pPars );
     // save parameters
     nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
@@ -302,20 +312,20 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 
 /**Function*************************************************************
 
-  Synopsis    [Performs partitioned sequential SAT sweeping.]
+  Synopsis    [Performs one round of concurrent partitioned SAT sweeping.]
 
-  Description []
+  Description [Proves the partitions of the AIG on the thread pool and 
+  records the resulting equivalences in the AIG. Returns the number of
+  equivalences found.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+int Ssw_SignalCorrespondencePartRound( Aig_Man_t * pAig, Ssw_Pars_t * pPars, int nPartSize, int fPrintParts, int fVerbose )
 {
-    int fPrintParts = 1;
-    //char Buffer[100];
-    Aig_Man_t * pTemp, * pNew;
+    Aig_Man_t * pTemp;
     Vec_Ptr_t * vAigs;    
     Vec_Ptr_t * vGias;
     Vec_Ptr_t * vMaps;
@@ -323,16 +333,7 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     Vec_Int_t * vPart;
     int * pMapBack = NULL;
     int i, nCountPis, nCountRegs;
-    int nClasses, nPartSize, fVerbose;
-    abctime clk = Abc_Clock();
-    if ( pPars->fConstrs )
-    {
-        Abc_Print( 1, "Cannot use partitioned computation with constraints.\n" );
-        return NULL;
-    }
-    // save parameters
-    nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
-    fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
+    int nClasses, nClassesAll = 0;
     // generate partitions
     if ( pAig->vClockDoms )
     {
@@ -382,6 +383,7 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
         Gia_ManReprToAigRepr2( pTemp2, pGia );
         // remap back
         nClasses = Aig_TransferMappedClasses( pAig, pTemp2, pMapBack );
+        nClassesAll += nClasses;
         if ( fVerbose )
             Abc_Print( 1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
                 i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp)-Vec_IntSize(vPart), 0, 0, Aig_ManNodeNum(pTemp), 0, nClasses );
@@ -393,13 +395,143 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     Vec_PtrFree( vAigs );
     Vec_PtrFree( vGias );
     Vec_PtrFree( vMaps );
+    Vec_VecFree( (Vec_Vec_t *)vResult );
+    return nClassesAll;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers equivalences of the reduced AIG to the original.]
+
+  Description [The reduced AIG (pCur) is derived from the original AIG 
+  (pAig) by merging equivalences. Array vMap gives, for each object of pAig,
+  the literal of the corresponding object of pCur, or -1 if the object was
+  removed. Each object of pCur has one original object without a 
+  representative (the one with the smallest ID), and the classes of pCur 
+  are recorded in pAig using these objects. Returns the number of new 
+  equivalences.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_SignalCorrespondenceLift( Aig_Man_t * pAig, Aig_Man_t * pCur, Vec_Int_t * vMap )
+{
+    Vec_Int_t * vOrig = Vec_IntStartFull( Aig_ManObjNumMax(pCur) );
+    Vec_Int_t * vBest = Vec_IntStartFull( Aig_ManObjNumMax(pCur) );
+    Aig_Obj_t * pObj, * pRepr;
+    int i, iOrig, iBest, iLit, nAdded = 0;
+    // find the original object for each object of the reduced AIG
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        if ( Aig_ObjIsCo(pObj) || Aig_ObjRepr(pAig, pObj) || (iLit = Vec_IntEntry(vMap, i)) == -1 )
+            continue;
+        if ( Vec_IntEntry(vOrig, Abc_Lit2Var(iLit)) == -1 )
+            Vec_IntWriteEntry( vOrig, Abc_Lit2Var(iLit), i );
+    }
+    // find the original object with the smallest ID in each class
+    Aig_ManForEachObj( pCur, pObj, i )
+    {
+        if ( (iOrig = Vec_IntEntry(vOrig, i)) == -1 )
+            continue;
+        for ( pRepr = pObj; Aig_ObjRepr(pCur, pRepr); pRepr = Aig_ObjRepr(pCur, pRepr) );
+        iBest = Vec_IntEntry( vBest, pRepr->Id );
+        if ( iBest == -1 || iOrig < iBest )
+            Vec_IntWriteEntry( vBest, pRepr->Id, iOrig );
+    }
+    // record the classes in the original AIG
+    Aig_ManForEachObj( pCur, pObj, i )
+    {
+        if ( (iOrig = Vec_IntEntry(vOrig, i)) == -1 )
+            continue;
+        for ( pRepr = pObj; Aig_ObjRepr(pCur, pRepr); pRepr = Aig_ObjRepr(pCur, pRepr) );
+        iBest = Vec_IntEntry( vBest, pRepr->Id );
+        if ( iBest == iOrig )
+            continue;
+        Aig_ObjCreateRepr( pAig, Aig_ManObj(pAig, iBest), Aig_ManObj(pAig, iOrig) );
+        nAdded++;
+    }
+    Vec_IntFree( vOrig );
+    Vec_IntFree( vBest );
+    return nAdded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned sequential SAT sweeping.]
+
+  Description [Partitions are proved concurrently. After each round, 
+  the proved equivalences are merged into the classes of the original AIG,
+  the AIG is reduced and partitioned again, until no new equivalences are 
+  found in the reduced AIG.]
+               
+  SideEffects []
 
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+{
+    int fPrintParts = 1;
+    Aig_Man_t * pCur = pAig, * pNew;
+    Vec_Int_t * vMap = NULL;
+    Aig_Obj_t * pObj, * pData;
+    int i, iLit, iRound, nAdded, nPartSize, fVerbose;
+    abctime clk = Abc_Clock();
+    if ( pPars->fConstrs )
+    {
+        Abc_Print( 1, "Cannot use partitioned computation with constraints.\n" );
+        return NULL;
+    }
+    // save parameters
+    nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
+    fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
+    for ( iRound = 0; ; iRound++ )
+    {
+        // prove the partitions of the current AIG
+        nAdded = Ssw_SignalCorrespondencePartRound( pCur, pPars, nPartSize, fPrintParts && iRound == 0, fVerbose );
+        if ( pCur != pAig )
+            nAdded = Ssw_SignalCorrespondenceLift( pAig, pCur, vMap );
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "Round %2d : Reg = %6d. And = %7d. New equivs = %6d. ", 
+                iRound, Aig_ManRegNum(pCur), Aig_ManNodeNum(pCur), nAdded );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        if ( nAdded == 0 )
+            break;
+        // reduce the current AIG and update the mapping of the original objects
+        pNew = Aig_ManDupRepr( pCur, 0 );
+        if ( vMap == NULL )
+        {
+            vMap = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+            Aig_ManForEachObj( pAig, pObj, i )
+                Vec_IntWriteEntry( vMap, i, Abc_Var2Lit(i, 0) );
+        }
+        Aig_ManForEachObj( pAig, pObj, i )
+        {
+            if ( (iLit = Vec_IntEntry(vMap, i)) == -1 )
+                continue;
+            pData = (Aig_Obj_t *)Aig_ManObj(pCur, Abc_Lit2Var(iLit))->pData;
+            Vec_IntWriteEntry( vMap, i, pData ? Abc_Var2Lit(Aig_Regular(pData)->Id, Aig_IsComplement(pData) ^ Abc_LitIsCompl(iLit)) : -1 );
+        }
+        Aig_ManSeqCleanup( pNew );
+        Vec_IntForEachEntry( vMap, iLit, i )
+            if ( iLit >= 0 && Aig_ManObj(pNew, Abc_Lit2Var(iLit)) == NULL )
+                Vec_IntWriteEntry( vMap, i, -1 );
+        if ( pCur != pAig )
+            Aig_ManStop( pCur );
+        pCur = pNew;
+    }
+    if ( pCur != pAig )
+        Aig_ManStop( pCur );
+    Vec_IntFreeP( &vMap );
     // remap the AIG
     pNew = Aig_ManDupRepr( pAig, 0 );
     Aig_ManSeqCleanup( pNew );
 //    Aig_ManPrintStats( pAig );
 //    Aig_ManPrintStats( pNew );
-    Vec_VecFree( (Vec_Vec_t *)vResult );
     pPars->nPartSize = nPartSize;
     pPars->fVerbose = fVerbose;
     if ( fVerbose )
@@ -23,6 +23,7 @@
 #include "sat/bsat/satStore.h"
 #include "sat/satoko/satoko.h"
 #include "sat/glucose/AbcGlucose.h"
+#include "sat/bsat/satBackend.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
@@ -64,10 +65,14 @@ struct Gia_ManBmc_t_
     sat_solver *      pSat;        // SAT solver
     satoko_t *        pSat2;       // SAT solver
     bmcg_sat_solver * pSat3;       // SAT solver
+    Sat_Backend_t *   pSat4;       // SAT solver selected by name
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    // persistent session
+    int               fSession;    // the manager is kept across calls and owns pAig
+    int               nSessCalls;  // the number of calls served by this manager
 };
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
@@ -718,7 +723,7 @@ Vec_Int_t * Saig_ManBmcComputeMappingRefs( Aig_Man_t * p, Vec_Int_t * vMap )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLimit, int fUseSatoko, int fUseGlucose )
+Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLimit, int fUseSatoko, int fUseGlucose, char * pBackend )
 {
     Gia_ManBmc_t * p;
     Aig_Obj_t * pObj;
@@ -747,7 +752,13 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     p->vVisited = Vec_WecAlloc( 100 );
     // create solver
     p->nSatVars = 1;
-    if ( fUseSatoko )
+    if ( pBackend )
+    {
+        p->pSat4 = Sat_BackendStart( Sat_BackendFindType(pBackend) );
+        assert( p->pSat4->fIncremental );
+        Sat_BackendSetNVars( p->pSat4, 1000 );
+    }
+    else if ( fUseSatoko )
     {
         satoko_opts_t opts;
         satoko_default_opts(&opts);
@@ -798,17 +809,16 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
 ***********************************************************************/
 void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
 {
-    if ( p->pPars->fVerbose )
+    if ( p->pPars && p->pPars->fVerbose )
     {
         int nUsedVars = p->pSat ? sat_solver_count_usedvars(p->pSat) : 0;
+        int nVars = p->pSat4 ? Sat_BackendNVars(p->pSat4) : p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2);
         Abc_Print( 1, "LStart(P) = %d  LDelta(Q) = %d  LRatio(R) = %d  ReduceDB = %d  Vars = %d  Used = %d (%.2f %%)\n", 
             p->pSat ? p->pSat->nLearntStart     : 0, 
             p->pSat ? p->pSat->nLearntDelta     : 0, 
             p->pSat ? p->pSat->nLearntRatio     : 0, 
             p->pSat ? p->pSat->nDBreduces       : 0, 
-            p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2), 
-            nUsedVars, 
-            100.0*nUsedVars/(p->pSat ? sat_solver_nvars(p->pSat) : p->pSat3 ? bmcg_sat_solver_varnum(p->pSat3) : satoko_varnum(p->pSat2)) );
+            nVars, nUsedVars, 100.0*nUsedVars/nVars );
         Abc_Print( 1, "Buffs = %d. Dups = %d.   Hash hits = %d.  Hash misses = %d.  UniProps = %d.\n", 
             p->nBufNum, p->nDupNum, p->nHashHit, p->nHashMiss, p->nUniProps );
     }
@@ -830,6 +840,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     if ( p->pSat )  sat_solver_delete( p->pSat );
     if ( p->pSat2 ) satoko_destroy( p->pSat2 );
     if ( p->pSat3 ) bmcg_sat_solver_stop( p->pSat3 );
+    if ( p->pSat4 ) Sat_BackendStop( p->pSat4 );
     ABC_FREE( p->pTime4Outs );
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
@@ -1019,7 +1030,12 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 }
                 CutLit = CutLit / 3;
             }
-            if ( p->pSat2 )
+            if ( p->pSat4 )
+            {
+                if ( !Sat_BackendAddClause( p->pSat4, ClaLits, ClaLits+nClaLits ) )
+                    assert( 0 );
+            }
+            else if ( p->pSat2 )
             {
                 if ( !satoko_add_clause( p->pSat2, ClaLits, nClaLits ) )
                     assert( 0 );
@@ -1280,7 +1296,9 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
             Saig_ManBmcCreateCnf_rec( p, pTemp, iFrame-f );
     Lit = Saig_ManBmcLiteral( p, pObj, iFrame );
     // extend the SAT solver
-    if ( p->pSat2 )
+    if ( p->pSat4 )
+        Sat_BackendSetNVars( p->pSat4, p->nSatVars );
+    else if ( p->pSat2 )
         satoko_setnvars( p->pSat2, p->nSatVars );
     else if ( p->pSat3 )
     {
@@ -1399,7 +1417,12 @@ Abc_Cex_t * Saig_ManGenerateCex( Gia_ManBmc_t * p, int f, int i )
         Saig_ManForEachPi( p->pAig, pObjPi, k )
         {
             int iLit = Saig_ManBmcLiteral( p, pObjPi, j );
-            if ( p->pSat2 )
+            if ( p->pSat4 )
+            {
+                if ( iLit != ~0 && Sat_BackendValue(p->pSat4, lit_var(iLit)) )
+                    Abc_InfoSetBit( pCex->pData, iBit + k );
+            }
+            else if ( p->pSat2 )
             {
                 if ( iLit != ~0 && satoko_read_cex_varvalue(p->pSat2, lit_var(iLit)) )
                     Abc_InfoSetBit( pCex->pData, iBit + k );
@@ -1436,7 +1459,9 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return l_False;
     if ( Lit == 1 )
         return l_True;
-    if ( p->pSat2 )
+    if ( p->pSat4 )
+        return Sat_BackendSolve( p->pSat4, &Lit, &Lit + 1, p->pPars->nConfLimit );
+    else if ( p->pSat2 )
         return satoko_solve_assumptions_limit( p->pSat2, &Lit, 1, p->pPars->nConfLimit );
     else if ( p->pSat3 )
     {
@@ -1447,6 +1472,158 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two AIGs are structurally identical.]
+
+  Description [Both AIGs are expected to be compacted by Aig_ManDupSimple(),
+  so that the object IDs are assigned in the same order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcSessionMatch( Aig_Man_t * p, Aig_Man_t * pNew )
+{
+    Aig_Obj_t * pObj, * pObjNew;
+    int i;
+    if ( Aig_ManCiNum(p) != Aig_ManCiNum(pNew) || Aig_ManCoNum(p) != Aig_ManCoNum(pNew) || 
+         Aig_ManRegNum(p) != Aig_ManRegNum(pNew) || Aig_ManObjNumMax(p) != Aig_ManObjNumMax(pNew) )
+        return 0;
+    Aig_ManForEachObj( pNew, pObjNew, i )
+        if ( Aig_ManObj(p, i) == NULL )
+            return 0;
+    Aig_ManForEachObj( p, pObj, i )
+    {
+        pObjNew = Aig_ManObj( pNew, i );
+        if ( pObjNew == NULL || pObj->Type != pObjNew->Type )
+            return 0;
+        if ( Aig_ObjIsCi(pObj) && Aig_ObjCioId(pObj) != Aig_ObjCioId(pObjNew) )
+            return 0;
+        if ( (Aig_ObjIsNode(pObj) || Aig_ObjIsCo(pObj)) && 
+             (Aig_ObjFaninId0(pObj) != Aig_ObjFaninId0(pObjNew) || Aig_ObjFaninC0(pObj) != Aig_ObjFaninC0(pObjNew)) )
+            return 0;
+        if ( Aig_ObjIsNode(pObj) && 
+             (Aig_ObjFaninId1(pObj) != Aig_ObjFaninId1(pObjNew) || Aig_ObjFaninC1(pObj) != Aig_ObjFaninC1(pObjNew)) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the BMC manager kept from the previous call.]
+
+  Description [The manager is reused if the design is structurally the same 
+  and the same SAT solver is requested. In this case, the frames unrolled 
+  and the clauses derived by the previous calls (including the unit clauses
+  asserting that the outputs are not reachable) are preserved. Otherwise, 
+  the old session is deleted and a new one is started on a private copy 
+  of the AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_ManBmc_t * Saig_Bmc3ManSessionStart( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Gia_ManBmc_t * p = pPars->ppSession ? (Gia_ManBmc_t *)*pPars->ppSession : NULL;
+    Aig_Man_t * pCopy = Aig_ManDupSimple( pAig );
+    if ( p && Saig_ManBmcSessionMatch(p->pAig, pCopy) &&
+         (p->pSat4 ? pPars->pBackend && !strcmp(p->pSat4->pName, pPars->pBackend) : !pPars->pBackend &&
+         (p->pSat != NULL) == (!pPars->fUseSatoko && !pPars->fUseGlucose) &&
+         (p->pSat2 != NULL) == (pPars->fUseSatoko != 0) &&
+         (p->pSat3 != NULL) == (!pPars->fUseSatoko && pPars->fUseGlucose)) )
+    {
+        Aig_ManStop( pCopy );
+        // the runtime limits are relative to the previous call
+        if ( p->pSat4 )
+            Sat_BackendSetTimeout( p->pSat4, 0 );
+        else if ( p->pSat )
+            sat_solver_set_runtime_limit( p->pSat, 0 );
+        else if ( p->pSat2 )
+            satoko_set_runtime_limit( p->pSat2, 0 );
+        else
+            bmcg_sat_solver_set_runtime_limit( p->pSat3, 0 );
+        ABC_FREE( p->pTime4Outs );
+        if ( pPars->nTimeOutOne )
+        {
+            int i;
+            p->pTime4Outs = ABC_ALLOC( abctime, Saig_ManPoNum(p->pAig) );
+            for ( i = 0; i < Saig_ManPoNum(p->pAig); i++ )
+                p->pTime4Outs[i] = pPars->nTimeOutOne * CLOCKS_PER_SEC / 1000 + 1;
+        }
+        p->nSessCalls++;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Reusing BMC session with %d unrolled frames (call %d).\n", Vec_PtrSize(p->vId2Var), p->nSessCalls );
+        return p;
+    }
+    if ( p )
+    {
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "The design has changed. Restarting BMC session.\n" );
+        Saig_ManBmcSessionStop( p );
+    }
+    p = Saig_Bmc3ManStart( pCopy, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose, pPars->pBackend );
+    p->fSession = 1;
+    p->nSessCalls = 1;
+    *pPars->ppSession = p;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detaches the manager from the current call.]
+
+  Description [Counter-examples are moved into the user AIG. The manager 
+  is stopped unless it belongs to a persistent session.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_Bmc3ManFinish( Gia_ManBmc_t * p, Aig_Man_t * pAig )
+{
+    if ( !p->fSession )
+    {
+        Saig_Bmc3ManStop( p );
+        return;
+    }
+    if ( p->vCexes )
+    {
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = p->vCexes;
+        p->vCexes = NULL;
+    }
+    p->pPars = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the persistent BMC session.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcSessionStop( void * pSession )
+{
+    Gia_ManBmc_t * p = (Gia_ManBmc_t *)pSession;
+    Aig_Man_t * pAig;
+    if ( p == NULL )
+        return;
+    assert( p->fSession && p->pPars == NULL );
+    pAig = p->pAig;
+    Saig_Bmc3ManStop( p );
+    Aig_ManStop( pAig );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1461,6 +1638,7 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
 int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
 {
     Gia_ManBmc_t * p;
+    Aig_Man_t * pAigUser;
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
@@ -1479,9 +1657,15 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         pPars->nTimeOutOne = 0;
     nTimeToStopNG = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
     nTimeToStop   = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
-    // create BMC manager
-    p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose );
+    // create BMC manager or reuse the one kept by the previous call
+    if ( pPars->ppSession )
+        p = Saig_Bmc3ManSessionStart( pAig, pPars );
+    else
+        p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, pPars->fUseSatoko, pPars->fUseGlucose, pPars->pBackend );
     p->pPars = pPars;
+    // the session works on its own copy of the AIG
+    pAigUser = pAig;
+    pAig = p->pAig;
     if ( p->pSat )
     {
         p->pSat->nLearntStart = p->pPars->nLearnedStart;
@@ -1492,6 +1676,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         p->pSat->RunId        = p->pPars->RunId;
         p->pSat->pFuncStop    = p->pPars->pFuncStop;
     }
+    else if ( p->pSat4 )
+        Sat_BackendSetStop( p->pSat4, p->pPars->RunId, p->pPars->pFuncStop );
     else if ( p->pSat3 )
     {
 //        satoko_set_runid(p->pSat3, p->pPars->RunId);
@@ -1502,6 +1688,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         satoko_set_runid(p->pSat2, p->pPars->RunId);
         satoko_set_stop_func(p->pSat2, p->pPars->pFuncStop);
     }
+    if ( p->pSat4 && !Sat_BackendHasTimeout(p->pSat4) && (pPars->nTimeOut || pPars->nTimeOutOne || pPars->pFuncStop) )
+        Abc_Print( 0, "The SAT solver \"%s\" does not support runtime limits and external stopping; these are checked only between the calls.\n", p->pSat4->pName );
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
     if ( pPars->fVerbose )
@@ -1516,7 +1704,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     // set runtime limit
     if ( nTimeToStop )
     {
-        if ( p->pSat2 )
+        if ( p->pSat4 )
+            Sat_BackendSetTimeout( p->pSat4, nTimeToStop );
+        else if ( p->pSat2 )
             satoko_set_runtime_limit( p->pSat2, nTimeToStop );
         else if ( p->pSat3 )
             bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
@@ -1549,6 +1739,13 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // consider the next timeframe
         if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 && !nJumpFrame )
             pPars->iFrame = f-1;
+        // frames unrolled by the previous calls of the session are already mapped
+        if ( f < Vec_PtrSize(p->vId2Var) )
+        {
+            if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
+                continue;
+            goto solve;
+        }
         // map nodes of this section
         Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
         Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
@@ -1577,6 +1774,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         }
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
+solve:
         // create CNF upfront
         if ( pPars->fSolveAll )
         {
@@ -1649,7 +1847,9 @@ clkOther += Abc_Clock() - clk2;
             {
                 assert( p->pTime4Outs[i] > 0 );
                 clkOne = Abc_Clock();
-                if ( p->pSat2 )
+                if ( p->pSat4 )
+                    Sat_BackendSetTimeout( p->pSat4, p->pTime4Outs[i] + Abc_Clock() );
+                else if ( p->pSat2 )
                     satoko_set_runtime_limit( p->pSat2, p->pTime4Outs[i] + Abc_Clock() );
                 else if ( p->pSat3 )
                     bmcg_sat_solver_set_runtime_limit( p->pSat3, p->pTime4Outs[i] + Abc_Clock() );
@@ -1678,7 +1878,9 @@ nTimeUnsat += clkSatRun;
                 {
                     // add final unit clause
                     Lit = lit_neg( Lit );
-                    if ( p->pSat2 )
+                    if ( p->pSat4 )
+                        status = Sat_BackendAddClause( p->pSat4, &Lit, &Lit + 1 );
+                    else if ( p->pSat2 )
                         status = satoko_add_clause( p->pSat2, &Lit, 1 );
                     else if ( p->pSat3 )
                         status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
@@ -1713,12 +1915,12 @@ nTimeSat += clkSatRun;
                     {
                         Abc_Print( 1, "%4d %s : ", f,  fUnfinished ? "-" : "+" );
                         Abc_Print( 1, "Var =%8.0f. ",  (double)p->nSatVars );
-                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2)) );
-                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+                        Abc_Print( 1, "Cla =%9.0f. ",  (double)(p->pSat4 ? Sat_BackendClauses(p->pSat4) : p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2)) );
+                        Abc_Print( 1, "Conf =%7.0f. ", (double)(p->pSat4 ? Sat_BackendConflicts(p->pSat4) : p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
 //                        Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //                        Abc_Print( 1, "Uni =%7.0f. ",(double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
 //                        ABC_PRT( "Time", Abc_Clock() - clk );
-                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+                        Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat4 ? Sat_BackendLearnts(p->pSat4) : p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
                         Abc_Print( 1, "%4.0f MB",      4.25*(f+1)*p->nObjNums /(1<<20) );
                         Abc_Print( 1, "%4.0f MB",      1.0*(p->pSat ? sat_solver_memory(p->pSat) : 0)/(1<<20) );
                         Abc_Print( 1, "%9.2f sec  ",   (float)(Abc_Clock() - clkTotal)/(float)(CLOCKS_PER_SEC) );
@@ -1730,8 +1932,8 @@ nTimeSat += clkSatRun;
                         Abc_Print( 1, "\n" );
                         fflush( stdout );
                     }
-                    ABC_FREE( pAig->pSeqModel );
-                    pAig->pSeqModel = Saig_ManGenerateCex( p, f, i );
+                    ABC_FREE( pAigUser->pSeqModel );
+                    pAigUser->pSeqModel = Saig_ManGenerateCex( p, f, i );
                     goto finish;
                 }
                 pPars->nFailOuts++;
@@ -1761,7 +1963,9 @@ nTimeSat += clkSatRun;
                 nTimeToStop = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
                 if ( nTimeToStop )
                 {
-                    if ( p->pSat2 )
+                    if ( p->pSat4 )
+                        Sat_BackendSetTimeout( p->pSat4, nTimeToStop );
+                    else if ( p->pSat2 )
                         satoko_set_runtime_limit( p->pSat2, nTimeToStop );
                     else if ( p->pSat3 )
                         bmcg_sat_solver_set_runtime_limit( p->pSat3, nTimeToStop );
@@ -1780,7 +1984,12 @@ nTimeSat += clkSatRun;
                         continue;
                     // check if this output is solved
                     Lit = Saig_ManBmcCreateCnf( p, pObj, f );
-                    if ( p->pSat2 )
+                    if ( p->pSat4 )
+                    {
+                        if ( Sat_BackendValue(p->pSat4, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                            continue;
+                    }
+                    else if ( p->pSat2 )
                     {
                         if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
                             continue;
@@ -1833,7 +2042,7 @@ nTimeUndec += clkSatRun;
         }
         if ( pPars->fVerbose ) 
         {
-            if ( fFirst == 1 && f > 0 && (p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
+            if ( fFirst == 1 && f > 0 && (p->pSat4 ? Sat_BackendConflicts(p->pSat4) : p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) > 1 )
             {
                 fFirst = 0;
 //                Abc_Print( 1, "Outputs of frames up to %d are trivially UNSAT.\n", f );
@@ -1841,11 +2050,11 @@ nTimeUndec += clkSatRun;
             Abc_Print( 1, "%4d %s : ", f, fUnfinished ? "-" : "+" );
             Abc_Print( 1, "Var =%8.0f. ", (double)p->nSatVars );
 //            Abc_Print( 1, "Used =%8.0f. ", (double)sat_solver_count_usedvars(p->pSat) );
-            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2))   );
-            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
+            Abc_Print( 1, "Cla =%9.0f. ", (double)(p->pSat4 ? Sat_BackendClauses(p->pSat4) : p->pSat ? p->pSat->stats.clauses   : p->pSat3 ? bmcg_sat_solver_clausenum(p->pSat3)   : satoko_clausenum(p->pSat2))   );
+            Abc_Print( 1, "Conf =%7.0f. ",(double)(p->pSat4 ? Sat_BackendConflicts(p->pSat4) : p->pSat ? p->pSat->stats.conflicts : p->pSat3 ? bmcg_sat_solver_conflictnum(p->pSat3) : satoko_conflictnum(p->pSat2)) );
 //            Abc_Print( 1, "Imp =%10.0f. ", (double)p->pSat->stats.propagations );
 //            Abc_Print( 1, "Uni =%7.0f. ", (double)(p->pSat ? sat_solver_count_assigned(p->pSat) : 0) );
-            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
+            Abc_Print( 1, "Learn =%7.0f. ", (double)(p->pSat4 ? Sat_BackendLearnts(p->pSat4) : p->pSat ? p->pSat->stats.learnts : p->pSat3 ? bmcg_sat_solver_learntnum(p->pSat3) : satoko_learntnum(p->pSat2)) );
             if ( pPars->fSolveAll )
                 Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
             if ( pPars->nTimeOutOne )
@@ -1881,7 +2090,7 @@ finish:
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
     }
-    Saig_Bmc3ManStop( p );
+    Saig_Bmc3ManFinish( p, pAigUser );
     fflush( stdout );
     if ( pLogFile )
         fclose( pLogFile );
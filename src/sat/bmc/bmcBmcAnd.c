@@ -40,6 +40,7 @@ struct Bmc_Mna_t_
     Vec_Int_t *         vInputs;  // inputs of the cone
     Vec_Int_t *         vOutputs; // outputs of the cone
     Vec_Int_t *         vNodes;   // internal nodes of the cone
+    Vec_Int_t *         vClause;  // literals of the clause
     sat_solver *        pSat;     // SAT solver
     int                 nSatVars; // the counter of SAT variables
     abctime             clkStart; // starting time
@@ -394,6 +395,7 @@ Bmc_Mna_t * Bmc_MnaAlloc()
     p->vInputs   = Vec_IntAlloc( 1000 );
     p->vOutputs  = Vec_IntAlloc( 1000 );
     p->vNodes    = Vec_IntAlloc( 10000 );
+    p->vClause   = Vec_IntAlloc( 100 );
     p->pSat      = sat_solver_new();
     p->nSatVars  = 1;
     p->clkStart  = Abc_Clock();
@@ -408,6 +410,7 @@ void Bmc_MnaFree( Bmc_Mna_t * p )
     Vec_IntFreeP( &p->vInputs );
     Vec_IntFreeP( &p->vOutputs );
     Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vClause );
     sat_solver_delete( p->pSat );
     ABC_FREE( p );
 }
@@ -892,18 +895,18 @@ void Gia_ManBmcAddCnfNew_rec( Bmc_Mna_t * p, Gia_Obj_t * pObj )
         iCla  = p->pCnf->pObj2Clause[iObj];
         for ( i = 0; i < nClas; i++ )
         {
-            int nLits, pLits[10];
+            int nLits;
             int * pClauseThis = p->pCnf->pClauses[iCla+i];
             int * pClauseNext = p->pCnf->pClauses[iCla+i+1];
+            Vec_IntClear( p->vClause );
             for ( nLits = 0; pClauseThis + nLits < pClauseNext; nLits++ )
             {
                 if ( pClauseThis[nLits] < 2 )
                     printf( "\n\n\nError in CNF generation:  Constant literal!\n\n\n" );
                 assert( pClauseThis[nLits] > 1 && pClauseThis[nLits] < 2*Gia_ManObjNum(p->pFrames) );
-                pLits[nLits] = Abc_Lit2LitV( Vec_IntArray(p->vId2Var), pClauseThis[nLits] );
+                Vec_IntPush( p->vClause, Abc_Lit2LitV( Vec_IntArray(p->vId2Var), pClauseThis[nLits] ) );
             }
-            assert( nLits <= 9 );
-            if ( !sat_solver_addclause( p->pSat, pLits, pLits + nLits ) )
+            if ( !sat_solver_addclause( p->pSat, Vec_IntArray(p->vClause), Vec_IntLimit(p->vClause) ) )
                 break;
         }
         if ( i < nClas )
@@ -937,10 +940,7 @@ void Gia_ManBmcAddCnfNew( Bmc_Mna_t * p, int iStart, int iStop )
 ***********************************************************************/
 static inline Cnf_Dat_t * Cnf_DeriveGia( Gia_Man_t * p )
 {
-    Aig_Man_t * pAig = Gia_ManToAigSimple( p );
-    Cnf_Dat_t * pCnf = Cnf_DeriveOther( pAig, 1 );
-    Aig_ManStop( pAig );
-    return pCnf;
+    return (Cnf_Dat_t *)Gia_ManCnfDeriveFast( p, 1, 0, 0 );
 }
 
 /**Function*************************************************************
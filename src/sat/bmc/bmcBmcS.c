@@ -383,10 +383,13 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
     for ( i = 0; i < pPars->nProcs; i++ )
     {
-        // modify parameters to get different SAT solvers
-        opts.f_rst = 0.8 - i * 0.05;
-        opts.b_rst = 1.4 - i * 0.05;
-        opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
+        // modify parameters to get different SAT solvers (windows use the same solver)
+        if ( !pPars->nWinSize )
+        {
+            opts.f_rst = 0.8 - i * 0.05;
+            opts.b_rst = 1.4 - i * 0.05;
+            opts.garbage_max_ratio = (float) 0.3 + i * 0.05;
+        }
         // create SAT solvers
         p->pSats[i] = bmc_sat_solver_start( i );  
 #ifdef ABC_USE_EXT_SOLVERS
@@ -616,10 +619,12 @@ Abc_Cex_t * Bmcs_ManGenerateCex( Bmcs_Man_t * p, int i, int f, int s )
     Gia_ManForEachPi( p->pFrames, pObj, k )
     {
         int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
+        int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
+        int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
+        if ( iFrame > f ) // unfolded beyond the failure
+            continue;
         if ( iSatVar > 0 && bmc_sat_solver_read_cex_varvalue(p->pSats[s], iSatVar) ) // 1 bit
         {
-            int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
-            int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
             Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + iCiId );
         }
     }
@@ -726,6 +731,11 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 #ifndef ABC_USE_PTHREADS
 
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs_ManPerformOne(pGia, pPars); }
+int Bmcs_ManPerformWindows( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
+{ 
+    printf( "Checking windows of frames (switch \"-W\") requires pthreads. Using one solver.\n" );
+    return Bmcs_ManPerformOne(pGia, pPars); 
+}
 
 #else // pthreads are used
 
@@ -908,6 +918,231 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves staggered windows of timeframes concurrently.]
+
+  Description [Each round unfolds nProcs * nWinSize frames into the shared
+  unfolding and derives the CNF once, one chunk for each window. Solver s 
+  checks the outputs in frames [f + s*nWinSize, f + (s+1)*nWinSize) in its 
+  own thread. It loads the chunks up to the end of its window only; the 
+  later chunks are loaded in the next round. Every solver still holds the 
+  clauses of all frames preceding its window, so the memory grows with 
+  the number of solvers; what is shared is the unfolding and the CNF 
+  computation. A counter-example stops the solvers of the deeper windows,
+  so the shallowest failure of the round is reported. Between rounds,
+  the top-level units derived by any solver are given to all of them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Bmcs_WinData_t_
+{
+    Bmcs_Man_t *      p;
+    struct Bmcs_WinData_t_ * pWins; // the windows of this round
+    int               nWins;       // the number of windows
+    int               iSolver;     // the solver checking this window
+    int               fStop;       // the stop flag of this solver
+    int               iFrameBeg;   // the first frame of the window
+    int               iFrameEnd;   // the frame following the window
+    int               fTrivial;    // the outputs of the window are constant 0
+    int               iFrameDone;  // the frames [iFrameBeg, iFrameDone) are proved
+    int               iOutFail;    // the failed output in frame iFrameDone
+    int               status;      // l_False (all proved), l_True (failed), l_Undef (stopped)
+    abctime           clkStart;    // the starting time
+} Bmcs_WinData_t;
+
+void * Bmcs_ManWindowThread( void * pArg )
+{
+    Bmcs_WinData_t * pData = (Bmcs_WinData_t *)pArg;
+    Bmcs_Man_t * p = pData->p;
+    int f, i, status = l_False, nPos = Gia_ManPoNum(p->pGia);
+    pData->iOutFail = -1;
+    for ( f = pData->iFrameBeg; f < pData->iFrameEnd; f++ )
+    {
+        for ( i = 0; i < nPos; i++ )
+        {
+            int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, f * nPos + i) );
+            int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
+            if ( pData->fStop || (p->pPars->nTimeOut && (Abc_Clock() - pData->clkStart)/CLOCKS_PER_SEC >= p->pPars->nTimeOut) )
+            {
+                status = l_Undef;
+                break;
+            }
+            status = bmc_sat_solver_solve( p->pSats[pData->iSolver], &iLit, 1 );
+            if ( status != l_False )
+                break;
+        }
+        if ( i < nPos )
+            break;
+    }
+    if ( status == l_True )
+    {
+        // the deeper windows are not needed; the shallower ones continue
+        pData->iOutFail = i;
+        for ( i = pData->iSolver + 1; i < pData->nWins; i++ )
+            pData->pWins[i].fStop = 1;
+    }
+    pData->iFrameDone = f;
+    pData->status = f == pData->iFrameEnd ? l_False : status;
+    return NULL;
+}
+void Bmcs_ManShareUnits( Bmcs_Man_t * p, int nSolvers, Vec_Int_t * vUnits )
+{
+    Vec_IntClear( vUnits );
+#ifndef ABC_USE_EXT_SOLVERS
+    {
+        int s, k, nUnits, * pUnits;
+        for ( s = 0; s < nSolvers; s++ )
+        {
+            nUnits = satoko_read_units( p->pSats[s], &pUnits );
+            for ( k = 0; k < nUnits; k++ )
+                Vec_IntPush( vUnits, pUnits[k] );
+        }
+        Vec_IntUniqify( vUnits );
+    }
+#endif
+}
+int Bmcs_ManPerformWindows( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    abctime clkStart = Abc_Clock();
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Bmcs_WinData_t ThData[PAR_THR_MAX];
+    int nLoaded[PAR_THR_MAX], nVars[PAR_THR_MAX];
+    Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
+    Vec_Int_t * vUnits = Vec_IntAlloc( 1000 );
+    Vec_Ptr_t * vCnfs = Vec_PtrAlloc( 100 ); // window CNFs (NULL if trivial or loaded by all solvers)
+    Cnf_Dat_t * pCnf;
+    int nFramesRound = pPars->nProcs * pPars->nWinSize;
+    int f, i, k, s, Lit, status, iCnf, nFrames = 0, nWins, nShared = 0, fStop = 0, RetValue = -1, nClauses = 0, iFrameDone = 0;
+    Abc_CexFreeP( &pGia->pCexSeq );
+    for ( s = 0; s < pPars->nProcs; s++ )
+    {
+        nLoaded[s] = 0, nVars[s] = p->nSatVars;
+        bmc_sat_solver_setstop( p->pSats[s], &ThData[s].fStop );
+    }
+    for ( f = 0; !fStop && (!pPars->nFramesMax || f < pPars->nFramesMax); f += nFrames )
+    {
+        abctime clk;
+        nFrames = pPars->nFramesMax ? Abc_MinInt( nFramesRound, pPars->nFramesMax - f ) : nFramesRound;
+        nWins   = (nFrames + pPars->nWinSize - 1) / pPars->nWinSize;
+        assert( nWins <= pPars->nProcs );
+        // unfold the windows and derive their CNFs
+        iCnf = Vec_PtrSize( vCnfs );
+        for ( s = 0; s < nWins; s++ )
+        {
+            ThData[s].p         = p;
+            ThData[s].pWins     = ThData;
+            ThData[s].nWins     = nWins;
+            ThData[s].iSolver   = s;
+            ThData[s].fStop     = 0;
+            ThData[s].iFrameBeg = f + s * pPars->nWinSize;
+            ThData[s].iFrameEnd = Abc_MinInt( f + (s+1) * pPars->nWinSize, f + nFrames );
+            ThData[s].clkStart  = clkStart;
+            pCnf = Bmcs_ManAddNewCnf( p, ThData[s].iFrameBeg, ThData[s].iFrameEnd - ThData[s].iFrameBeg );
+            ThData[s].fTrivial = (pCnf == NULL);
+            Vec_PtrPush( vCnfs, pCnf );
+            if ( pCnf )
+                nClauses += pCnf->nClauses;
+        }
+        // load the CNFs up to the end of each window and the units learned in the previous round
+        for ( s = 0; s < nWins; s++ )
+        {
+            for ( ; nVars[s] < p->nSatVars; nVars[s]++ )
+                bmc_sat_solver_addvar( p->pSats[s] );
+            for ( ; nLoaded[s] <= iCnf + s; nLoaded[s]++ )
+                if ( (pCnf = (Cnf_Dat_t *)Vec_PtrEntry(vCnfs, nLoaded[s])) )
+                    for ( k = 0; k < pCnf->nClauses; k++ )
+                        if ( !bmc_sat_solver_addclause( p->pSats[s], pCnf->pClauses[k], pCnf->pClauses[k+1]-pCnf->pClauses[k] ) )
+                            assert( 0 );
+            Vec_IntForEachEntry( vUnits, Lit, k )
+                bmc_sat_solver_addclause( p->pSats[s], &Lit, 1 );
+        }
+        // free the CNFs loaded into all solvers
+        for ( k = 0, i = nLoaded[0]; k < pPars->nProcs; k++ )
+            i = Abc_MinInt( i, nLoaded[k] );
+        for ( k = 0; k < i; k++ )
+            if ( (pCnf = (Cnf_Dat_t *)Vec_PtrEntry(vCnfs, k)) )
+                Cnf_DataFree( pCnf ), Vec_PtrWriteEntry( vCnfs, k, NULL );
+        // solve the windows
+        clk = Abc_Clock();
+        for ( s = 0; s < nWins; s++ )
+        {
+            if ( ThData[s].fTrivial )
+            {
+                ThData[s].iFrameDone = ThData[s].iFrameEnd;
+                ThData[s].iOutFail   = -1;
+                ThData[s].status     = l_False;
+                continue;
+            }
+            status = pthread_create( WorkerThread + s, NULL, Bmcs_ManWindowThread, (void *)(ThData + s) );  assert( status == 0 );
+        }
+        for ( s = 0; s < nWins; s++ )
+            if ( !ThData[s].fTrivial )
+                pthread_join( WorkerThread[s], NULL );
+        p->timeSat += Abc_Clock() - clk;
+        // report the frames proved without gaps
+        for ( s = 0; s < nWins; s++ )
+        {
+            for ( k = ThData[s].iFrameBeg; k < ThData[s].iFrameDone; k++ )
+            {
+                Bmcs_ManPrintFrame( p, k, nClauses, s, clkStart );
+                if ( pPars->pFuncOnFrameDone )
+                    for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
+                        pPars->pFuncOnFrameDone(k, i, 0);
+            }
+            if ( ThData[s].status != l_False )
+                break;
+        }
+        iFrameDone = s < nWins ? ThData[s].iFrameDone : f + nFrames;
+        // report the shallowest counter-example
+        for ( s = 0; s < nWins; s++ )
+            if ( ThData[s].status == l_True )
+                break;
+        if ( s < nWins )
+        {
+            RetValue = 0;
+            pPars->iFrame = ThData[s].iFrameDone;
+            pGia->pCexSeq = Bmcs_ManGenerateCex( p, ThData[s].iOutFail, ThData[s].iFrameDone, s );
+            pPars->nFailOuts++;
+            if ( !pPars->fNotVerbose )
+            {
+                int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
+                Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",  
+                    nOutDigits, ThData[s].iOutFail, ThData[s].iFrameDone, nOutDigits, pPars->nFailOuts, nOutDigits, Gia_ManPoNum(pGia) );
+                fflush( stdout );
+            }
+            if ( pPars->pFuncOnFrameDone )
+                pPars->pFuncOnFrameDone(ThData[s].iFrameDone, ThData[s].iOutFail, 1);
+            fStop = 1;
+        }
+        // stop if some window is unfinished; otherwise, share the units
+        else if ( iFrameDone < f + nFrames )
+            fStop = 1;
+        else
+        {
+            Bmcs_ManShareUnits( p, nWins, vUnits );
+            nShared += Vec_IntSize(vUnits);
+        }
+    }
+    p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
+    if ( RetValue == -1 && !pPars->fNotVerbose )
+        printf( "No output failed in %d frames.  ", iFrameDone );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( pPars->fVerbose )
+        printf( "Used %d solvers with %d-frame windows. Shared %d top-level units.\n", pPars->nProcs, pPars->nWinSize, nShared );
+    Bmcs_ManPrintTime( p );
+    Bmcs_ManStop( p );
+    Vec_IntFree( vUnits );
+    Vec_PtrForEachEntry( Cnf_Dat_t *, vCnfs, pCnf, k )
+        if ( pCnf )
+            Cnf_DataFree( pCnf );
+    Vec_PtrFree( vCnfs );
+    return RetValue;
+}
+
 #endif // pthreads are used
 
 
@@ -925,6 +1160,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
 { 
     assert( pPars->nProcs < PAR_THR_MAX );
+    if ( pPars->nWinSize )
+        return Bmcs_ManPerformWindows( pGia, pPars );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
     else
@@ -332,13 +332,7 @@ void Cnf_AddCardinConstrTest()
 ***********************************************************************/
 static inline Cnf_Dat_t * Cnf_DeriveGiaRemapped( Gia_Man_t * p )
 {
-    Cnf_Dat_t * pCnf;
-    Aig_Man_t * pAig = Gia_ManToAigSimple( p );
-    pAig->nRegs = 0;
-    pCnf = Cnf_Derive( pAig, Aig_ManCoNum(pAig) );
-    Aig_ManStop( pAig );
-    return pCnf;
-//    return (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
+    return (Cnf_Dat_t *)Gia_ManCnfDeriveFast( p, 0, 0, 0 );
 }
 
 /**Function*************************************************************
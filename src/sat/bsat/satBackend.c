@@ -0,0 +1,480 @@
+/**CFile****************************************************************
+
+  FileName    [satBackend.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solvers.]
+
+  Synopsis    [Uniform interface to the SAT solvers available in ABC.]
+
+  Author      []
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "satSolver.h"
+#include "satBackend.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose/AbcGlucose.h"
+#include "sat/cadical/cadicalSolver.h"
+#include "sat/cadical/ccadical.h"
+#include "sat/kissat/kissatSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static char * s_SatBackendNames[SAT_BACKEND_NUM] = { "bsat", "satoko", "glucose", "glucose2", "cadical", "kissat" };
+
+// the Glucose2 adapters are in satBackendG2.c because AbcGlucose2.h 
+// and AbcGlucose.h share the include guard and cannot be used together
+extern void Sat_BackendStartGlucose2( Sat_Backend_t * p );
+
+// CaDiCaL is wrapped to keep the runtime limit, the stop function and 
+// the conflict count, which the stock C interface does not provide
+typedef struct Sat_Cadical_t_ Sat_Cadical_t;
+struct Sat_Cadical_t_
+{
+    cadical_solver * pSat;           // the solver
+    abctime          nRuntimeLimit;  // the runtime limit
+    int              RunId;          // the ID of this run
+    int           (* pFuncStop)(int);// the stop function
+    int              nConflicts;     // the number of learned clauses
+};
+
+// Kissat is not incremental; the clauses are kept here and each call 
+// solves the problem from scratch with the assumptions as unit clauses
+typedef struct Sat_Kissat_t_ Sat_Kissat_t;
+struct Sat_Kissat_t_
+{
+    int              nVars;          // the number of variables
+    Vec_Int_t *      vClauses;       // clauses, each is preceded by its size
+    Vec_Int_t *      vCore;          // negated assumptions of the last UNSAT call
+    Vec_Int_t *      vModel;         // variable values of the last SAT call
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for bsat.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void    Sat_BsatStop( void * p )                                 { sat_solver_delete( (sat_solver *)p );                                        }
+static void    Sat_BsatSetNVars( void * p, int nVars )                  { sat_solver_setnvars( (sat_solver *)p, nVars );                               }
+static int     Sat_BsatNVars( void * p )                                { return sat_solver_nvars( (sat_solver *)p );                                  }
+static int     Sat_BsatAddClause( void * p, int * pBeg, int * pEnd )    { return sat_solver_addclause( (sat_solver *)p, pBeg, pEnd );                  }
+static int     Sat_BsatSolve( void * p, int * pBeg, int * pEnd, int nConfLimit ) { return sat_solver_solve( (sat_solver *)p, pBeg, pEnd, (ABC_INT64_T)nConfLimit, 0, 0, 0 ); }
+static int     Sat_BsatValue( void * p, int iVar )                      { return sat_solver_var_value( (sat_solver *)p, iVar );                        }
+static int     Sat_BsatFinal( void * p, int ** ppLits )                 { return sat_solver_final( (sat_solver *)p, ppLits );                          }
+static int     Sat_BsatConflicts( void * p )                            { return sat_solver_nconflicts( (sat_solver *)p );                             }
+static int     Sat_BsatClauses( void * p )                              { return sat_solver_nclauses( (sat_solver *)p );                               }
+static int     Sat_BsatLearnts( void * p )                              { return (int)((sat_solver *)p)->stats.learnts;                                }
+static abctime Sat_BsatSetTimeout( void * p, abctime Limit )            { return sat_solver_set_runtime_limit( (sat_solver *)p, Limit );               }
+static void    Sat_BsatSetStop( void * p, int RunId, int (*pFuncStop)(int) ) { ((sat_solver *)p)->RunId = RunId; ((sat_solver *)p)->pFuncStop = pFuncStop; }
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for Satoko.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void    Sat_SatokoStop( void * p )                               { satoko_destroy( (satoko_t *)p );                                             }
+static void    Sat_SatokoSetNVars( void * p, int nVars )                { satoko_setnvars( (satoko_t *)p, nVars );                                     }
+static int     Sat_SatokoNVars( void * p )                              { return satoko_varnum( (satoko_t *)p );                                       }
+static int     Sat_SatokoAddClause( void * p, int * pBeg, int * pEnd )  { return satoko_add_clause( (satoko_t *)p, pBeg, (int)(pEnd - pBeg) );         }
+static int     Sat_SatokoSolve( void * p, int * pBeg, int * pEnd, int nConfLimit ) { return satoko_solve_assumptions_limit( (satoko_t *)p, pBeg, (int)(pEnd - pBeg), nConfLimit ); }
+static int     Sat_SatokoValue( void * p, int iVar )                    { return satoko_read_cex_varvalue( (satoko_t *)p, iVar );                      }
+static int     Sat_SatokoFinal( void * p, int ** ppLits )               { return satoko_final_conflict( (satoko_t *)p, ppLits );                       }
+static int     Sat_SatokoConflicts( void * p )                          { return satoko_conflictnum( (satoko_t *)p );                                  }
+static int     Sat_SatokoClauses( void * p )                            { return satoko_clausenum( (satoko_t *)p );                                    }
+static int     Sat_SatokoLearnts( void * p )                            { return satoko_learntnum( (satoko_t *)p );                                    }
+static abctime Sat_SatokoSetTimeout( void * p, abctime Limit )          { return satoko_set_runtime_limit( (satoko_t *)p, Limit );                     }
+static void    Sat_SatokoSetStop( void * p, int RunId, int (*pFuncStop)(int) ) { satoko_set_runid( (satoko_t *)p, RunId ); satoko_set_stop_func( (satoko_t *)p, pFuncStop ); }
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for Glucose.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void    Sat_GlucoseStop( void * p )                              { bmcg_sat_solver_stop( (bmcg_sat_solver *)p );                                }
+static void    Sat_GlucoseSetNVars( void * p, int nVars )               { bmcg_sat_solver_set_nvars( (bmcg_sat_solver *)p, nVars );                    }
+static int     Sat_GlucoseNVars( void * p )                             { return bmcg_sat_solver_varnum( (bmcg_sat_solver *)p );                       }
+static int     Sat_GlucoseAddClause( void * p, int * pBeg, int * pEnd ) { return bmcg_sat_solver_addclause( (bmcg_sat_solver *)p, pBeg, (int)(pEnd - pBeg) ); }
+static int     Sat_GlucoseSolve( void * p, int * pBeg, int * pEnd, int nConfLimit ) 
+{ 
+    bmcg_sat_solver_set_conflict_budget( (bmcg_sat_solver *)p, nConfLimit );
+    return bmcg_sat_solver_solve( (bmcg_sat_solver *)p, pBeg, (int)(pEnd - pBeg) );
+}
+static int     Sat_GlucoseValue( void * p, int iVar )                   { return bmcg_sat_solver_read_cex_varvalue( (bmcg_sat_solver *)p, iVar );      }
+static int     Sat_GlucoseFinal( void * p, int ** ppLits )              { return bmcg_sat_solver_final( (bmcg_sat_solver *)p, ppLits );                }
+static int     Sat_GlucoseConflicts( void * p )                         { return bmcg_sat_solver_conflictnum( (bmcg_sat_solver *)p );                  }
+static int     Sat_GlucoseClauses( void * p )                           { return bmcg_sat_solver_clausenum( (bmcg_sat_solver *)p );                    }
+static int     Sat_GlucoseLearnts( void * p )                           { return bmcg_sat_solver_learntnum( (bmcg_sat_solver *)p );                    }
+static abctime Sat_GlucoseSetTimeout( void * p, abctime Limit )         { return bmcg_sat_solver_set_runtime_limit( (bmcg_sat_solver *)p, Limit );     }
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for CaDiCaL.]
+
+  Description [The runtime limit and the stop function are checked in 
+  the terminate callback of CaDiCaL. The conflicts are counted in the 
+  learn callback, which is called once for each learned clause. The 
+  number of learned clauses is not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sat_CadicalTerminate( void * pState )
+{
+    Sat_Cadical_t * p = (Sat_Cadical_t *)pState;
+    if ( p->nRuntimeLimit && Abc_Clock() > p->nRuntimeLimit )
+        return 1;
+    return p->pFuncStop && p->pFuncStop( p->RunId );
+}
+static void Sat_CadicalLearn( void * pState, int * pClause )
+{
+    ((Sat_Cadical_t *)pState)->nConflicts++;
+}
+static void Sat_CadicalUpdateTerminate( Sat_Cadical_t * p )
+{
+    if ( p->nRuntimeLimit || p->pFuncStop )
+        ccadical_set_terminate( (CCaDiCaL *)p->pSat->p, p, Sat_CadicalTerminate );
+    else
+        ccadical_set_terminate( (CCaDiCaL *)p->pSat->p, NULL, NULL );
+}
+static void * Sat_CadicalStart( void )
+{
+    Sat_Cadical_t * p = ABC_CALLOC( Sat_Cadical_t, 1 );
+    p->pSat = cadical_solver_new();
+    ccadical_set_learn( (CCaDiCaL *)p->pSat->p, p, ABC_INFINITY, Sat_CadicalLearn );
+    return p;
+}
+static void Sat_CadicalStop( void * pSolver )
+{
+    Sat_Cadical_t * p = (Sat_Cadical_t *)pSolver;
+    cadical_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+static void    Sat_CadicalSetNVars( void * p, int nVars )               { cadical_solver_setnvars( ((Sat_Cadical_t *)p)->pSat, nVars );                }
+static int     Sat_CadicalNVars( void * p )                             { return cadical_solver_nvars( ((Sat_Cadical_t *)p)->pSat );                   }
+static int     Sat_CadicalAddClause( void * p, int * pBeg, int * pEnd ) { return cadical_solver_addclause( ((Sat_Cadical_t *)p)->pSat, pBeg, pEnd );   }
+static int     Sat_CadicalSolve( void * p, int * pBeg, int * pEnd, int nConfLimit ) { return cadical_solver_solve( ((Sat_Cadical_t *)p)->pSat, pBeg, pEnd, (ABC_INT64_T)nConfLimit, 0, 0, 0 ); }
+static int     Sat_CadicalValue( void * p, int iVar )                   { return cadical_solver_get_var_value( ((Sat_Cadical_t *)p)->pSat, iVar );     }
+static int     Sat_CadicalFinal( void * p, int ** ppLits )              { return cadical_solver_final( ((Sat_Cadical_t *)p)->pSat, ppLits );           }
+static int     Sat_CadicalConflicts( void * p )                         { return ((Sat_Cadical_t *)p)->nConflicts;                                     }
+static int     Sat_CadicalClauses( void * p )                           { return (int)ccadical_irredundant( (CCaDiCaL *)((Sat_Cadical_t *)p)->pSat->p ); }
+static abctime Sat_CadicalSetTimeout( void * pSolver, abctime Limit )
+{
+    Sat_Cadical_t * p = (Sat_Cadical_t *)pSolver;
+    abctime nRuntimeLimit = p->nRuntimeLimit;
+    p->nRuntimeLimit = Limit;
+    Sat_CadicalUpdateTerminate( p );
+    return nRuntimeLimit;
+}
+static void Sat_CadicalSetStop( void * pSolver, int RunId, int (*pFuncStop)(int) )
+{
+    Sat_Cadical_t * p = (Sat_Cadical_t *)pSolver;
+    p->RunId     = RunId;
+    p->pFuncStop = pFuncStop;
+    Sat_CadicalUpdateTerminate( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for Kissat.]
+
+  Description [Since Kissat is not incremental, each call creates a new 
+  solver, loads the recorded clauses and the assumptions as unit clauses,
+  and solves the problem. The final conflict is approximated by the 
+  complete set of the negated assumptions. No learned clauses are kept
+  between the calls. Kissat does not poll the terminate callback, so
+  the runtime limit and the stop function are not supported. The stock 
+  interface does not report statistics, so the conflicts are not counted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sat_KissatStart( void )
+{
+    Sat_Kissat_t * p = ABC_CALLOC( Sat_Kissat_t, 1 );
+    p->vClauses = Vec_IntAlloc( 1000 );
+    p->vCore    = Vec_IntAlloc( 100 );
+    p->vModel   = Vec_IntAlloc( 1000 );
+    return p;
+}
+static void Sat_KissatStop( void * pSolver )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    Vec_IntFree( p->vClauses );
+    Vec_IntFree( p->vCore );
+    Vec_IntFree( p->vModel );
+    ABC_FREE( p );
+}
+static void Sat_KissatSetNVars( void * pSolver, int nVars )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    p->nVars = Abc_MaxInt( p->nVars, nVars );
+}
+static int Sat_KissatNVars( void * pSolver )
+{
+    return ((Sat_Kissat_t *)pSolver)->nVars;
+}
+static int Sat_KissatAddClause( void * pSolver, int * pBeg, int * pEnd )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    Vec_IntPush( p->vClauses, (int)(pEnd - pBeg) );
+    for ( ; pBeg < pEnd; pBeg++ )
+    {
+        p->nVars = Abc_MaxInt( p->nVars, Abc_Lit2Var(*pBeg) + 1 );
+        Vec_IntPush( p->vClauses, *pBeg );
+    }
+    return 1;
+}
+static int Sat_KissatSolve( void * pSolver, int * pBeg, int * pEnd, int nConfLimit )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    kissat_solver * pSat = kissat_solver_new();
+    int i, * pLit, nSize, status = 1;
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+        p->nVars = Abc_MaxInt( p->nVars, Abc_Lit2Var(*pLit) + 1 );
+    kissat_solver_setnvars( pSat, p->nVars );
+    for ( i = 0; status && i < Vec_IntSize(p->vClauses); i += nSize + 1 )
+    {
+        nSize  = Vec_IntEntry( p->vClauses, i );
+        status = kissat_solver_addclause( pSat, Vec_IntEntryP(p->vClauses, i+1), Vec_IntEntryP(p->vClauses, i+1) + nSize );
+    }
+    for ( pLit = pBeg; status && pLit < pEnd; pLit++ )
+        status = kissat_solver_addclause( pSat, pLit, pLit + 1 );
+    status = status ? kissat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, 0, 0, 0 ) : -1;
+    Vec_IntClear( p->vCore );
+    Vec_IntClear( p->vModel );
+    if ( status == 1 )
+        for ( i = 0; i < p->nVars; i++ )
+            Vec_IntPush( p->vModel, kissat_solver_get_var_value(pSat, i) );
+    else if ( status == -1 )
+        for ( pLit = pBeg; pLit < pEnd; pLit++ )
+            Vec_IntPush( p->vCore, Abc_LitNot(*pLit) );
+    kissat_solver_delete( pSat );
+    return status;
+}
+static int Sat_KissatValue( void * pSolver, int iVar )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    return iVar < Vec_IntSize(p->vModel) ? Vec_IntEntry( p->vModel, iVar ) : 0;
+}
+static int Sat_KissatFinal( void * pSolver, int ** ppLits )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    *ppLits = Vec_IntArray( p->vCore );
+    return Vec_IntSize( p->vCore );
+}
+static int Sat_KissatClauses( void * pSolver )
+{
+    Sat_Kissat_t * p = (Sat_Kissat_t *)pSolver;
+    int i, nSize, Count = 0;
+    for ( i = 0; i < Vec_IntSize(p->vClauses); i += nSize + 1, Count++ )
+        nSize = Vec_IntEntry( p->vClauses, i );
+    return Count;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the solver of the given type.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Backend_t * Sat_BackendStart( int Type )
+{
+    Sat_Backend_t * p = ABC_CALLOC( Sat_Backend_t, 1 );
+    assert( Type >= 0 && Type < SAT_BACKEND_NUM );
+    p->Type         = Type;
+    p->pName        = s_SatBackendNames[Type];
+    p->fIncremental = Sat_BackendTypeIsIncremental( Type );
+    if ( Type == SAT_BACKEND_BSAT )
+    {
+        p->pSolver         = sat_solver_new();
+        p->pFuncStop       = Sat_BsatStop;
+        p->pFuncSetNVars   = Sat_BsatSetNVars;
+        p->pFuncNVars      = Sat_BsatNVars;
+        p->pFuncAddClause  = Sat_BsatAddClause;
+        p->pFuncSolve      = Sat_BsatSolve;
+        p->pFuncValue      = Sat_BsatValue;
+        p->pFuncFinal      = Sat_BsatFinal;
+        p->pFuncConflicts  = Sat_BsatConflicts;
+        p->pFuncClauses    = Sat_BsatClauses;
+        p->pFuncLearnts    = Sat_BsatLearnts;
+        p->pFuncSetTimeout = Sat_BsatSetTimeout;
+        p->pFuncSetStop    = Sat_BsatSetStop;
+    }
+    else if ( Type == SAT_BACKEND_SATOKO )
+    {
+        satoko_opts_t opts;
+        satoko_default_opts( &opts );
+        p->pSolver         = satoko_create();
+        satoko_configure( (satoko_t *)p->pSolver, &opts );
+        p->pFuncStop       = Sat_SatokoStop;
+        p->pFuncSetNVars   = Sat_SatokoSetNVars;
+        p->pFuncNVars      = Sat_SatokoNVars;
+        p->pFuncAddClause  = Sat_SatokoAddClause;
+        p->pFuncSolve      = Sat_SatokoSolve;
+        p->pFuncValue      = Sat_SatokoValue;
+        p->pFuncFinal      = Sat_SatokoFinal;
+        p->pFuncConflicts  = Sat_SatokoConflicts;
+        p->pFuncClauses    = Sat_SatokoClauses;
+        p->pFuncLearnts    = Sat_SatokoLearnts;
+        p->pFuncSetTimeout = Sat_SatokoSetTimeout;
+        p->pFuncSetStop    = Sat_SatokoSetStop;
+    }
+    else if ( Type == SAT_BACKEND_GLUCOSE )
+    {
+        p->pSolver         = bmcg_sat_solver_start();
+        p->pFuncStop       = Sat_GlucoseStop;
+        p->pFuncSetNVars   = Sat_GlucoseSetNVars;
+        p->pFuncNVars      = Sat_GlucoseNVars;
+        p->pFuncAddClause  = Sat_GlucoseAddClause;
+        p->pFuncSolve      = Sat_GlucoseSolve;
+        p->pFuncValue      = Sat_GlucoseValue;
+        p->pFuncFinal      = Sat_GlucoseFinal;
+        p->pFuncConflicts  = Sat_GlucoseConflicts;
+        p->pFuncClauses    = Sat_GlucoseClauses;
+        p->pFuncLearnts    = Sat_GlucoseLearnts;
+        p->pFuncSetTimeout = Sat_GlucoseSetTimeout;
+    }
+    else if ( Type == SAT_BACKEND_GLUCOSE2 )
+    {
+        Sat_BackendStartGlucose2( p );
+    }
+    else if ( Type == SAT_BACKEND_CADICAL )
+    {
+        p->pSolver         = Sat_CadicalStart();
+        p->pFuncStop       = Sat_CadicalStop;
+        p->pFuncSetNVars   = Sat_CadicalSetNVars;
+        p->pFuncNVars      = Sat_CadicalNVars;
+        p->pFuncAddClause  = Sat_CadicalAddClause;
+        p->pFuncSolve      = Sat_CadicalSolve;
+        p->pFuncValue      = Sat_CadicalValue;
+        p->pFuncFinal      = Sat_CadicalFinal;
+        p->pFuncConflicts  = Sat_CadicalConflicts;
+        p->pFuncClauses    = Sat_CadicalClauses;
+        p->pFuncSetTimeout = Sat_CadicalSetTimeout;
+        p->pFuncSetStop    = Sat_CadicalSetStop;
+    }
+    else if ( Type == SAT_BACKEND_KISSAT )
+    {
+        p->pSolver         = Sat_KissatStart();
+        p->pFuncStop       = Sat_KissatStop;
+        p->pFuncSetNVars   = Sat_KissatSetNVars;
+        p->pFuncNVars      = Sat_KissatNVars;
+        p->pFuncAddClause  = Sat_KissatAddClause;
+        p->pFuncSolve      = Sat_KissatSolve;
+        p->pFuncValue      = Sat_KissatValue;
+        p->pFuncFinal      = Sat_KissatFinal;
+        p->pFuncClauses    = Sat_KissatClauses;
+    }
+    return p;
+}
+void Sat_BackendStop( Sat_Backend_t * p )
+{
+    p->pFuncStop( p->pSolver );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under assumptions.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT), or 0 (undecided).
+  The conflict limit is for this call (0 = no limit).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_BackendSolve( Sat_Backend_t * p, int * pBeg, int * pEnd, int nConfLimit )
+{
+    p->nCalls++;
+    return p->pFuncSolve( p->pSolver, pBeg, pEnd, nConfLimit );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts between the solver types and their names.]
+
+  Description [Returns -1 if the name is unknown. A solver type is 
+  incremental if the repeated calls keep the learned clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_BackendFindType( char * pName )
+{
+    int i;
+    for ( i = 0; i < SAT_BACKEND_NUM; i++ )
+        if ( !strcmp(pName, s_SatBackendNames[i]) )
+            return i;
+    return -1;
+}
+char * Sat_BackendTypeName( int Type )
+{
+    assert( Type >= 0 && Type < SAT_BACKEND_NUM );
+    return s_SatBackendNames[Type];
+}
+int Sat_BackendTypeIsIncremental( int Type )
+{
+    assert( Type >= 0 && Type < SAT_BACKEND_NUM );
+    return Type != SAT_BACKEND_KISSAT;
+}
+void Sat_BackendPrintTypes( void )
+{
+    int i;
+    for ( i = 0; i < SAT_BACKEND_NUM; i++ )
+        printf( "%s%s", i ? ", " : "", s_SatBackendNames[i] );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
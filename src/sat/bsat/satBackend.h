@@ -0,0 +1,111 @@
+/**CFile****************************************************************
+
+  FileName    [satBackend.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solvers.]
+
+  Synopsis    [Uniform interface to the SAT solvers available in ABC.]
+
+  Author      []
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satBackend_h
+#define ABC__sat__bsat__satBackend_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// the SAT solvers that can be used through this interface
+typedef enum { 
+    SAT_BACKEND_BSAT = 0,    // MiniSat-based solver by Niklas Sorensson (sat_solver)
+    SAT_BACKEND_SATOKO,      // Satoko by Bruno Schmitt
+    SAT_BACKEND_GLUCOSE,     // Glucose 3.0 by Gilles Audemard and Laurent Simon
+    SAT_BACKEND_GLUCOSE2,    // Glucose 3.0 with ABC extensions
+    SAT_BACKEND_CADICAL,     // CaDiCaL by Armin Biere
+    SAT_BACKEND_KISSAT,      // Kissat by Armin Biere (not incremental)
+    SAT_BACKEND_NUM
+} Sat_BackendType_t;
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// literals are ABC literals (2*Var+Compl); the status values are 1 (SAT), -1 (UNSAT), and 0 (undecided)
+typedef struct Sat_Backend_t_ Sat_Backend_t;
+struct Sat_Backend_t_
+{
+    int              Type;           // solver type (Sat_BackendType_t)
+    char *           pName;          // solver name
+    int              fIncremental;   // solver supports repeated calls and assumptions
+    int              nCalls;         // the number of solver calls
+    void *           pSolver;        // solver
+    // solver operations
+    void          (* pFuncStop)      ( void * pSolver );
+    void          (* pFuncSetNVars)  ( void * pSolver, int nVars );
+    int           (* pFuncNVars)     ( void * pSolver );
+    int           (* pFuncAddClause) ( void * pSolver, int * pBeg, int * pEnd );
+    int           (* pFuncSolve)     ( void * pSolver, int * pBeg, int * pEnd, int nConfLimit );
+    int           (* pFuncValue)     ( void * pSolver, int iVar );
+    int           (* pFuncFinal)     ( void * pSolver, int ** ppLits );
+    int           (* pFuncConflicts) ( void * pSolver );
+    int           (* pFuncClauses)   ( void * pSolver );
+    int           (* pFuncLearnts)   ( void * pSolver );
+    abctime       (* pFuncSetTimeout)( void * pSolver, abctime Limit );
+    void          (* pFuncSetStop)   ( void * pSolver, int RunId, int (*pFuncStop)(int) );
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+static inline void    Sat_BackendSetNVars( Sat_Backend_t * p, int nVars )                 { p->pFuncSetNVars( p->pSolver, nVars );                            }
+static inline int     Sat_BackendNVars( Sat_Backend_t * p )                               { return p->pFuncNVars( p->pSolver );                               }
+static inline int     Sat_BackendAddClause( Sat_Backend_t * p, int * pBeg, int * pEnd )   { return p->pFuncAddClause( p->pSolver, pBeg, pEnd );               }
+static inline int     Sat_BackendValue( Sat_Backend_t * p, int iVar )                     { return p->pFuncValue( p->pSolver, iVar );                         }
+static inline int     Sat_BackendFinal( Sat_Backend_t * p, int ** ppLits )                { return p->pFuncFinal ? p->pFuncFinal( p->pSolver, ppLits ) : 0;   }
+static inline int     Sat_BackendConflicts( Sat_Backend_t * p )                           { return p->pFuncConflicts ? p->pFuncConflicts( p->pSolver ) : 0;   }
+static inline int     Sat_BackendClauses( Sat_Backend_t * p )                             { return p->pFuncClauses ? p->pFuncClauses( p->pSolver ) : 0;       }
+static inline int     Sat_BackendLearnts( Sat_Backend_t * p )                             { return p->pFuncLearnts ? p->pFuncLearnts( p->pSolver ) : 0;       }
+static inline abctime Sat_BackendSetTimeout( Sat_Backend_t * p, abctime Limit )           { return p->pFuncSetTimeout ? p->pFuncSetTimeout( p->pSolver, Limit ) : 0; }
+static inline int     Sat_BackendHasTimeout( Sat_Backend_t * p )                          { return p->pFuncSetTimeout != NULL;                                }
+static inline void    Sat_BackendSetStop( Sat_Backend_t * p, int RunId, int (*pFuncStop)(int) ) { if ( p->pFuncSetStop ) p->pFuncSetStop( p->pSolver, RunId, pFuncStop ); }
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satBackend.c ==========================================================*/
+extern Sat_Backend_t *  Sat_BackendStart( int Type );
+extern void             Sat_BackendStop( Sat_Backend_t * p );
+extern int              Sat_BackendSolve( Sat_Backend_t * p, int * pBeg, int * pEnd, int nConfLimit );
+extern int              Sat_BackendFindType( char * pName );
+extern char *           Sat_BackendTypeName( int Type );
+extern int              Sat_BackendTypeIsIncremental( int Type );
+extern void             Sat_BackendPrintTypes( void );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
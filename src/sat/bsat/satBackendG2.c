@@ -0,0 +1,94 @@
+/**CFile****************************************************************
+
+  FileName    [satBackendG2.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solvers.]
+
+  Synopsis    [Adapters of the uniform SAT solver interface for Glucose2.]
+
+  Author      []
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "satBackend.h"
+#include "sat/glucose2/AbcGlucose2.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adapters for Glucose with ABC extensions.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void    Sat_Glucose2Stop( void * p )                             { bmcg2_sat_solver_stop( (bmcg2_sat_solver *)p );                              }
+static void    Sat_Glucose2SetNVars( void * p, int nVars )              { bmcg2_sat_solver_set_nvars( (bmcg2_sat_solver *)p, nVars );                  }
+static int     Sat_Glucose2NVars( void * p )                            { return bmcg2_sat_solver_varnum( (bmcg2_sat_solver *)p );                     }
+static int     Sat_Glucose2AddClause( void * p, int * pBeg, int * pEnd ){ return bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)p, pBeg, (int)(pEnd - pBeg) ); }
+static int     Sat_Glucose2Solve( void * p, int * pBeg, int * pEnd, int nConfLimit ) 
+{ 
+    bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)p, nConfLimit );
+    return bmcg2_sat_solver_solve( (bmcg2_sat_solver *)p, pBeg, (int)(pEnd - pBeg) );
+}
+static int     Sat_Glucose2Value( void * p, int iVar )                  { return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)p, iVar );    }
+static int     Sat_Glucose2Final( void * p, int ** ppLits )             { return bmcg2_sat_solver_final( (bmcg2_sat_solver *)p, ppLits );              }
+static int     Sat_Glucose2Conflicts( void * p )                        { return bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)p );                }
+static int     Sat_Glucose2Clauses( void * p )                          { return bmcg2_sat_solver_clausenum( (bmcg2_sat_solver *)p );                  }
+static int     Sat_Glucose2Learnts( void * p )                          { return bmcg2_sat_solver_learntnum( (bmcg2_sat_solver *)p );                  }
+static abctime Sat_Glucose2SetTimeout( void * p, abctime Limit )        { return bmcg2_sat_solver_set_runtime_limit( (bmcg2_sat_solver *)p, Limit );   }
+
+/**Function*************************************************************
+
+  Synopsis    [Installs Glucose2 into the backend.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_BackendStartGlucose2( Sat_Backend_t * p )
+{
+    p->pSolver         = bmcg2_sat_solver_start();
+    p->pFuncStop       = Sat_Glucose2Stop;
+    p->pFuncSetNVars   = Sat_Glucose2SetNVars;
+    p->pFuncNVars      = Sat_Glucose2NVars;
+    p->pFuncAddClause  = Sat_Glucose2AddClause;
+    p->pFuncSolve      = Sat_Glucose2Solve;
+    p->pFuncValue      = Sat_Glucose2Value;
+    p->pFuncFinal      = Sat_Glucose2Final;
+    p->pFuncConflicts  = Sat_Glucose2Conflicts;
+    p->pFuncClauses    = Sat_Glucose2Clauses;
+    p->pFuncLearnts    = Sat_Glucose2Learnts;
+    p->pFuncSetTimeout = Sat_Glucose2SetTimeout;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -67,6 +67,10 @@ struct Inta_Man_t_
     FILE *          pFile;        // the file for proof recording
     // internal verification
     Vec_Int_t *     vResLits;
+    // streaming proof processing
+    Sto_Cls_t **    pBins;        // hash table of the live learned clauses read from the trace
+    int             nBins;        // the number of bins in the hash table
+    Vec_Ptr_t *     vKept;        // learned clauses that cannot be freed before the end
     // runtime stats
     abctime         timeBcp;      // the runtime for BCP
     abctime         timeTrace;    // the runtime of trace construction
@@ -88,6 +92,9 @@ static inline void         Inta_ManAigOrNotVar( Inta_Man_t * pMan, Aig_Obj_t **
 static inline int          Inta_ManProofGet( Inta_Man_t * p, Sto_Cls_t * pCls )                  { return p->pProofNums[pCls->Id];           }
 static inline void         Inta_ManProofSet( Inta_Man_t * p, Sto_Cls_t * pCls, int n )           { p->pProofNums[pCls->Id] = n;              }
 
+// the learned clauses read from the trace are preceded by the hash key of their literals
+static inline unsigned     Inta_ManTraceKey( Sto_Cls_t * pCls )                                  { return (unsigned)*((word *)pCls - 1);     }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -709,7 +716,8 @@ p->timeTrace += Abc_Clock() - clk;
 
   Synopsis    [Records the proof for one clause.]
 
-  Description []
+  Description [Returns 0 if the empty clause is derived. When the learned
+  clauses are streamed, returns 2 if the clause is added to the watch lists.]
                
   SideEffects []
 
@@ -768,6 +776,17 @@ int Inta_ManProofRecordOne( Inta_Man_t * p, Sto_Cls_t * pClause )
         {
             // undo to the root level
             Inta_ManCancelUntil( p, p->nRootSize );
+            // when the proof is streamed, the conflict clause may be deleted later
+            // while the solver still uses this clause; keep the weaker clause 
+            // with the interpolant and the proof of the conflict clause
+            if ( p->pCnf->pTrace && pClause->nLits > 1 )
+            {
+                Inta_ManAigCopy( p, Inta_ManAigRead(p, pClause), Inta_ManAigRead(p, pConflict) );
+                Inta_ManProofSet( p, pClause, Inta_ManProofGet(p, pConflict) );
+                Inta_ManWatchClause( p, pClause, pClause->pLits[0] );
+                Inta_ManWatchClause( p, pClause, pClause->pLits[1] );
+                return 2;
+            }
             return 1;
         }
     }
@@ -783,7 +802,7 @@ int Inta_ManProofRecordOne( Inta_Man_t * p, Sto_Cls_t * pClause )
     {
         Inta_ManWatchClause( p, pClause, pClause->pLits[0] );
         Inta_ManWatchClause( p, pClause, pClause->pLits[1] );
-        return 1;
+        return p->pCnf->pTrace ? 2 : 1;
     }
     assert( pClause->nLits == 1 );
 
@@ -834,7 +853,7 @@ int Inta_ManProcessRoots( Inta_Man_t * p )
         assert( (int)pClause->fRoot == (Counter < (int)p->pCnf->nRoots)    );
         Counter++;
     }
-    assert( p->pCnf->nClauses == Counter );
+    assert( p->pCnf->nClauses == Counter + p->pCnf->nTraced );
 
     // make sure the last clause if empty
     assert( p->pCnf->pTail->nLits == 0 );
@@ -883,6 +902,186 @@ int Inta_ManProcessRoots( Inta_Man_t * p )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates and frees learned clauses read from the trace.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Inta_ManTraceHash( lit * pLits, int nLits )
+{
+    unsigned Key = 0;
+    int i;
+    for ( i = 0; i < nLits; i++ )
+        Key = Key * 0x9E3779B1 + (unsigned)pLits[i];
+    return Key;
+}
+static inline Sto_Cls_t * Inta_ManTraceAlloc( lit * pLits, int nLits, unsigned Key )
+{
+    char * pMem = ABC_ALLOC( char, sizeof(word) + sizeof(Sto_Cls_t) + sizeof(lit) * nLits );
+    Sto_Cls_t * pClause = (Sto_Cls_t *)(pMem + sizeof(word));
+    *(word *)pMem = (word)Key;
+    memset( pClause, 0, sizeof(Sto_Cls_t) );
+    pClause->nLits = nLits;
+    memcpy( pClause->pLits, pLits, sizeof(lit) * nLits );
+    return pClause;
+}
+static inline void Inta_ManTraceFree( Sto_Cls_t * pClause )
+{
+    char * pMem = (char *)pClause - sizeof(word);
+    ABC_FREE( pMem );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the clause from the watch list of the literal.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Inta_ManUnwatchClause( Inta_Man_t * p, Sto_Cls_t * pClause, lit Lit )
+{
+    Sto_Cls_t ** ppPrev, * pCur;
+    ppPrev = p->pWatches + lit_neg(Lit);
+    for ( pCur = *ppPrev; pCur; pCur = *ppPrev )
+    {
+        if ( pCur == pClause )
+        {
+            *ppPrev = pCur->pLits[0] == Lit ? pCur->pNext0 : pCur->pNext1;
+            return;
+        }
+        ppPrev = pCur->pLits[0] == Lit ? &pCur->pNext0 : &pCur->pNext1;
+    }
+    assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the deletion of a learned clause.]
+
+  Description [Looks up the clause with the same literals in the table, 
+  removes it from the table and from the watch lists, and frees it, 
+  unless it is the reason of a root-level assignment, in which case it 
+  is kept until the end. The literals are sorted as in the trace; the 
+  key is their hash. Only the clauses watched after recording their 
+  proof are in the table; the other ones are not found. Returns 1 if 
+  the clause is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inta_ManTraceDelete( Inta_Man_t * p, lit * pLits, int nLits, unsigned Key )
+{
+    Sto_Cls_t ** ppPrev, * pCur;
+    int i;
+    for ( i = 0; i < nLits; i++ )
+        p->pSeens[lit_var(pLits[i])] = 1 + lit_sign(pLits[i]);
+    ppPrev = p->pBins + Key % p->nBins;
+    for ( pCur = *ppPrev; pCur; ppPrev = &pCur->pNext, pCur = *ppPrev )
+    {
+        if ( Inta_ManTraceKey(pCur) != Key || (int)pCur->nLits != nLits )
+            continue;
+        for ( i = 0; i < (int)pCur->nLits; i++ )
+            if ( p->pSeens[lit_var(pCur->pLits[i])] != 1 + lit_sign(pCur->pLits[i]) )
+                break;
+        if ( i == (int)pCur->nLits )
+            break;
+    }
+    for ( i = 0; i < nLits; i++ )
+        p->pSeens[lit_var(pLits[i])] = 0;
+    if ( pCur == NULL )
+        return 0;
+    // remove the clause from the table and from the watch lists
+    *ppPrev = pCur->pNext;
+    assert( pCur->nLits > 1 );
+    Inta_ManUnwatchClause( p, pCur, pCur->pLits[0] );
+    Inta_ManUnwatchClause( p, pCur, pCur->pLits[1] );
+    // the clause may be the reason of a root-level assignment
+    if ( p->pReasons[lit_var(pCur->pLits[0])] == pCur )
+        Vec_PtrPush( p->vKept, pCur );
+    else
+        Inta_ManTraceFree( pCur );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the proof for the learned clauses in the trace.]
+
+  Description [Reads the trace of the learned and deleted clauses and 
+  replays it, so that only the clauses alive in the solver are kept in 
+  memory. Returns 0 if the empty clause is derived, -1 on timeout.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inta_ManProcessTrace( Inta_Man_t * p, abctime TimeToStop )
+{
+    Sto_Man_t * pCnf = p->pCnf;
+    Sto_Cls_t * pClause;
+    int i, nLits, fDelete, Id = pCnf->nRoots, RetValue = 1;
+    unsigned Key;
+    p->nBins = Abc_PrimeCudd( pCnf->nTraced + 1 );
+    p->pBins = ABC_CALLOC( Sto_Cls_t *, p->nBins );
+    p->vKept = Vec_PtrAlloc( 100 );
+    Sto_ManTraceRewind( pCnf );
+    while ( (nLits = Sto_ManTraceReadClause( pCnf, &fDelete )) >= 0 )
+    {
+        Key = Inta_ManTraceHash( pCnf->pBuffer, nLits );
+        if ( fDelete )
+        {
+            Inta_ManTraceDelete( p, pCnf->pBuffer, nLits, Key );
+            continue;
+        }
+        pClause = Inta_ManTraceAlloc( pCnf->pBuffer, nLits, Key );
+        pClause->Id = Id++;
+        RetValue = Inta_ManProofRecordOne( p, pClause );
+        if ( RetValue == 2 )
+        {
+            pClause->pNext = p->pBins[Key % p->nBins];
+            p->pBins[Key % p->nBins] = pClause;
+        }
+        else if ( RetValue == 0 || p->pReasons[lit_var(pClause->pLits[0])] == pClause )
+            Vec_PtrPush( p->vKept, pClause );
+        else
+            Inta_ManTraceFree( pClause );
+        if ( RetValue == 0 )
+            break;
+        if ( TimeToStop && Abc_Clock() > TimeToStop )
+        {
+            RetValue = -1;
+            break;
+        }
+    }
+    assert( Id <= pCnf->nRoots + pCnf->nTraced );
+    // free the remaining clauses
+    for ( i = 0; i < p->nBins; i++ )
+        while ( (pClause = p->pBins[i]) )
+        {
+            p->pBins[i] = pClause->pNext;
+            Inta_ManTraceFree( pClause );
+        }
+    Vec_PtrForEachEntry( Sto_Cls_t *, p->vKept, pClause, i )
+        Inta_ManTraceFree( pClause );
+    Vec_PtrFreeP( &p->vKept );
+    ABC_FREE( p->pBins );
+    p->nBins = 0;
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Records the proof.]
@@ -989,23 +1188,37 @@ void * Inta_ManInterpolate( Inta_Man_t * p, Sto_Man_t * pCnf, abctime TimeToStop
     // propagate root level assignments
     if ( Inta_ManProcessRoots( p ) )
     {
-        // if there is no conflict, consider learned clauses
-        Sto_ManForEachClause( p->pCnf, pClause )
+        if ( p->pCnf->pTrace )
         {
-            if ( pClause->fRoot )
-                continue;
-            if ( !Inta_ManProofRecordOne( p, pClause ) )
-            {
-                RetValue = 0;
-                break;
-            }
-            if ( TimeToStop && Abc_Clock() > TimeToStop )
+            // if there is no conflict, consider learned clauses streamed from the trace
+            RetValue = Inta_ManProcessTrace( p, TimeToStop );
+            if ( RetValue == -1 )
             {
                 Aig_ManStop( pRes );
                 p->pAig = NULL;
                 return NULL;
             }
         }
+        else
+        {
+            // if there is no conflict, consider learned clauses
+            Sto_ManForEachClause( p->pCnf, pClause )
+            {
+                if ( pClause->fRoot )
+                    continue;
+                if ( !Inta_ManProofRecordOne( p, pClause ) )
+                {
+                    RetValue = 0;
+                    break;
+                }
+                if ( TimeToStop && Abc_Clock() > TimeToStop )
+                {
+                    Aig_ManStop( pRes );
+                    p->pAig = NULL;
+                    return NULL;
+                }
+            }
+        }
     }
 
     // stop the proof
@@ -1023,6 +1236,8 @@ void * Inta_ManInterpolate( Inta_Man_t * p, Sto_Man_t * pCnf, abctime TimeToStop
         p->pCnf->nVars, p->pCnf->nRoots, p->pCnf->nClauses-p->pCnf->nRoots, p->Counter,  
         1.0*(p->Counter-p->pCnf->nRoots)/(p->pCnf->nClauses-p->pCnf->nRoots), 
         1.0*Sto_ManMemoryReport(p->pCnf)/(1<<20) );
+    if ( p->pCnf->pTrace )
+    printf( "Deleted = %d. Trace = %.2f MB  ", p->pCnf->nTraceDels, 1.0*Sto_ManTraceSize(p->pCnf)/(1<<20) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
 p->timeTotal += Abc_Clock() - clkTotal;
     }
@@ -0,0 +1,583 @@
+/**CFile****************************************************************
+
+  FileName    [satService.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solvers.]
+
+  Synopsis    [In-process SAT solving service shared by the commands.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "misc/vec/vec.h"
+#include "misc/vec/vecHsh.h"
+#include "satBackend.h"
+#include "satService.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SAT_SERVICE_CANCELED -2     // the job was removed from the queue
+#define SAT_SERVICE_PENDING   2     // the job is waiting in the queue
+#define SAT_SERVICE_RUNNING   3     // the job is being solved
+
+typedef struct Sat_ServiceWorker_t_ Sat_ServiceWorker_t;
+struct Sat_ServiceWorker_t_
+{
+    Sat_Service_t *  pMan;          // the service
+    Sat_Backend_t *  pSat;          // the solver
+    int              iCnf;          // the CNF loaded into the solver (-1 if none)
+    int              fUnsat;        // the loaded CNF is UNSAT without assumptions
+    Vec_Int_t *      vCnf;          // copy of the CNF to be loaded
+    Vec_Int_t *      vJob;          // copy of the job being solved
+    Vec_Str_t *      vModel;        // the model of the job being solved
+    int              nJobs;         // the number of solved jobs
+    int              nLoads;        // the number of loaded CNFs
+};
+
+struct Sat_Service_t_
+{
+    int              SolverType;    // the solver type (Sat_BackendType_t)
+    int              nThreads;      // the number of workers
+    int              nMemLimit;     // the memory limit of the tables in MB (0 = no limit)
+    Hsh_VecMan_t *   pCnfs;         // CNFs (the number of variables followed by clauses, each preceded by its size)
+    Hsh_VecMan_t *   pJobs;         // jobs (the CNF, the conflict limit, and the assumptions)
+    Vec_Int_t *      vStatus;       // the status of each job
+    Vec_Ptr_t *      vModels;       // the model of each satisfiable job
+    Vec_Int_t *      vQueue;        // the jobs waiting to be solved
+    int              iQueue;        // the first waiting job
+    int              nRunning;      // the number of jobs being solved
+    double           MemModels;     // the memory used by the models
+    int              fStop;         // the service is stopping
+    Sat_ServiceWorker_t Workers[SAT_SERVICE_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t        Threads[SAT_SERVICE_THR_MAX];
+    pthread_mutex_t  Mutex;         // protects the data above
+    pthread_cond_t   Cond;          // signals new jobs and results
+#endif
+    // statistics
+    int              nSubmits;      // submitted jobs
+    int              nHits;         // submitted jobs found in the table
+    int              nCnfs;         // submitted CNFs
+    int              nSolved[3];    // solved jobs (UNSAT, undecided, SAT)
+    int              nCanceled;     // canceled jobs
+    int              nClears;       // the number of times the tables were cleared
+};
+
+static Sat_Service_t * s_pSatService = NULL;
+
+#ifdef ABC_USE_PTHREADS
+static inline void Sat_ServiceLock( Sat_Service_t * p )        { pthread_mutex_lock( &p->Mutex );      }
+static inline void Sat_ServiceUnlock( Sat_Service_t * p )      { pthread_mutex_unlock( &p->Mutex );    }
+#else
+static inline void Sat_ServiceLock( Sat_Service_t * p )        {                                       }
+static inline void Sat_ServiceUnlock( Sat_Service_t * p )      {                                       }
+#endif
+
+static inline double Sat_ServiceMemory( Sat_Service_t * p )    { return Hsh_VecManMemory(p->pCnfs) + Hsh_VecManMemory(p->pJobs) + p->MemModels; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one job by the worker.]
+
+  Description [The worker's copy of the job is already made. If the CNF
+  of the job differs from the one in the solver, its copy is also made
+  and is loaded here. Otherwise, the solver is reused as is, including
+  the clauses learned while solving the previous jobs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sat_ServiceSolveJob( Sat_ServiceWorker_t * pW, int fLoad )
+{
+    int * pLits = Vec_IntArray(pW->vJob) + 2;
+    int * pStop = Vec_IntLimit(pW->vJob);
+    int i, nVars, status;
+    if ( fLoad )
+    {
+        if ( pW->pSat )
+            Sat_BackendStop( pW->pSat );
+        pW->pSat   = Sat_BackendStart( pW->pMan->SolverType );
+        pW->iCnf   = Vec_IntEntry( pW->vJob, 0 );
+        pW->fUnsat = 0;
+        pW->nLoads++;
+        Sat_BackendSetNVars( pW->pSat, Vec_IntEntry(pW->vCnf, 0) );
+        for ( i = 1; i < Vec_IntSize(pW->vCnf); i += Vec_IntEntry(pW->vCnf, i) + 1 )
+            if ( !Sat_BackendAddClause( pW->pSat, Vec_IntEntryP(pW->vCnf, i+1), Vec_IntEntryP(pW->vCnf, i+1) + Vec_IntEntry(pW->vCnf, i) ) )
+            {
+                pW->fUnsat = 1;
+                break;
+            }
+    }
+    pW->nJobs++;
+    Vec_StrClear( pW->vModel );
+    if ( pW->fUnsat )
+        return -1;
+    status = Sat_BackendSolve( pW->pSat, pLits, pStop, Vec_IntEntry(pW->vJob, 1) );
+    if ( status != 1 )
+        return status;
+    nVars = Sat_BackendNVars( pW->pSat );
+    for ( i = 0; i < nVars; i++ )
+        Vec_StrPush( pW->vModel, (char)Sat_BackendValue(pW->pSat, i) );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the next job from the queue and solves it.]
+
+  Description [Should be called with the lock taken; returns with the lock
+  taken. Returns 0 if the queue is empty.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sat_ServiceSolveNext( Sat_Service_t * p, Sat_ServiceWorker_t * pW )
+{
+    Vec_Int_t * vEntry;
+    int iJob, iCnf, status, fLoad;
+    if ( p->iQueue == Vec_IntSize(p->vQueue) )
+        return 0;
+    iJob = Vec_IntEntry( p->vQueue, p->iQueue++ );
+    Vec_IntWriteEntry( p->vStatus, iJob, SAT_SERVICE_RUNNING );
+    p->nRunning++;
+    vEntry = Hsh_VecReadEntry( p->pJobs, iJob );
+    Vec_IntClear( pW->vJob );
+    Vec_IntAppend( pW->vJob, vEntry );
+    iCnf  = Vec_IntEntry( pW->vJob, 0 );
+    fLoad = (pW->iCnf != iCnf);
+    if ( fLoad )
+    {
+        vEntry = Hsh_VecReadEntry( p->pCnfs, iCnf );
+        Vec_IntClear( pW->vCnf );
+        Vec_IntAppend( pW->vCnf, vEntry );
+    }
+    Sat_ServiceUnlock( p );
+    status = Sat_ServiceSolveJob( pW, fLoad );
+    Sat_ServiceLock( p );
+    p->nRunning--;
+    Vec_IntWriteEntry( p->vStatus, iJob, status );
+    if ( status == 1 )
+    {
+        Vec_PtrWriteEntry( p->vModels, iJob, Vec_StrDup(pW->vModel) );
+        p->MemModels += Vec_StrSize(pW->vModel) + sizeof(Vec_Str_t);
+    }
+    p->nSolved[status+1]++;
+    return 1;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Sat_ServiceWorkerThread( void * pArg )
+{
+    Sat_ServiceWorker_t * pW = (Sat_ServiceWorker_t *)pArg;
+    Sat_Service_t * p = pW->pMan;
+    pthread_mutex_lock( &p->Mutex );
+    while ( 1 )
+    {
+        while ( !p->fStop && p->iQueue == Vec_IntSize(p->vQueue) )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+        if ( p->fStop )
+            break;
+        Sat_ServiceSolveNext( p, pW );
+        pthread_cond_broadcast( &p->Cond );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Clears the tables of the service.]
+
+  Description [Sat_ServiceReset() should be called when no job is waiting
+  or running. Sat_ServiceClear() cancels the waiting jobs, waits for the 
+  running ones to finish, and clears the tables. After this, the IDs of 
+  the CNFs and jobs returned earlier are no longer valid. The solvers of 
+  the workers are also freed and will be started again for the next job.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sat_ServiceReset( Sat_Service_t * p )
+{
+    Vec_Str_t * vModel;
+    int i;
+    assert( p->iQueue == Vec_IntSize(p->vQueue) && p->nRunning == 0 );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        if ( p->Workers[i].pSat )
+            Sat_BackendStop( p->Workers[i].pSat );
+        p->Workers[i].pSat = NULL;
+        p->Workers[i].iCnf = -1;
+    }
+    Vec_PtrForEachEntry( Vec_Str_t *, p->vModels, vModel, i )
+        if ( vModel )
+            Vec_StrFree( vModel );
+    Vec_PtrClear( p->vModels );
+    Vec_IntClear( p->vStatus );
+    Vec_IntClear( p->vQueue );
+    p->iQueue    = 0;
+    p->MemModels = 0;
+    Hsh_VecManStop( p->pCnfs );
+    Hsh_VecManStop( p->pJobs );
+    p->pCnfs = Hsh_VecManStart( 100 );
+    p->pJobs = Hsh_VecManStart( 1000 );
+    p->nClears++;
+}
+void Sat_ServiceClear( Sat_Service_t * p )
+{
+    Sat_ServiceLock( p );
+    while ( p->iQueue < Vec_IntSize(p->vQueue) )
+    {
+        Vec_IntWriteEntry( p->vStatus, Vec_IntEntry(p->vQueue, p->iQueue++), SAT_SERVICE_CANCELED );
+        p->nCanceled++;
+    }
+#ifdef ABC_USE_PTHREADS
+    while ( p->nRunning > 0 )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+#endif
+    Sat_ServiceReset( p );
+    Sat_ServiceUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the service.]
+
+  Description [Without pthreads, the jobs are solved by the caller of
+  Sat_ServiceWait() using one worker. Stopping the service clears it 
+  first, which cancels the waiting jobs. The memory limit of the tables 
+  is in MB (0 = no limit).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Service_t * Sat_ServiceStart( int nThreads, int SolverType, int nMemLimit )
+{
+    Sat_Service_t * p;
+    int i;
+    assert( nThreads >= 1 && nThreads <= SAT_SERVICE_THR_MAX );
+    p = ABC_CALLOC( Sat_Service_t, 1 );
+    p->SolverType = SolverType;
+    p->nThreads   = nThreads;
+    p->nMemLimit  = nMemLimit;
+    p->pCnfs      = Hsh_VecManStart( 100 );
+    p->pJobs      = Hsh_VecManStart( 1000 );
+    p->vStatus    = Vec_IntAlloc( 1000 );
+    p->vModels    = Vec_PtrAlloc( 1000 );
+    p->vQueue     = Vec_IntAlloc( 1000 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->Workers[i].pMan   = p;
+        p->Workers[i].iCnf   = -1;
+        p->Workers[i].vCnf   = Vec_IntAlloc( 1000 );
+        p->Workers[i].vJob   = Vec_IntAlloc( 100 );
+        p->Workers[i].vModel = Vec_StrAlloc( 1000 );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        int RetValue = pthread_create( p->Threads + i, NULL, Sat_ServiceWorkerThread, (void *)(p->Workers + i) );  
+        assert( RetValue == 0 ); (void)RetValue;
+    }
+#endif
+    return p;
+}
+void Sat_ServiceStop( Sat_Service_t * p )
+{
+    int i;
+    Sat_ServiceClear( p );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+    p->fStop = 1;
+    pthread_cond_broadcast( &p->Cond );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nThreads; i++ )
+        pthread_join( p->Threads[i], NULL );
+    pthread_cond_destroy( &p->Cond );
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        Vec_IntFree( p->Workers[i].vCnf );
+        Vec_IntFree( p->Workers[i].vJob );
+        Vec_StrFree( p->Workers[i].vModel );
+    }
+    Vec_PtrFree( p->vModels );
+    Vec_IntFree( p->vStatus );
+    Vec_IntFree( p->vQueue );
+    Hsh_VecManStop( p->pCnfs );
+    Hsh_VecManStop( p->pJobs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cancels the waiting jobs over the CNF.]
+
+  Description [The jobs removed from the queue are reported as undecided
+  by Sat_ServiceWait(). If such a job is submitted again, it is put back
+  into the queue. The jobs being solved are not interrupted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_ServiceCancel( Sat_Service_t * p, int iCnf )
+{
+    int i, iJob, k;
+    Sat_ServiceLock( p );
+    for ( i = k = p->iQueue; i < Vec_IntSize(p->vQueue); i++ )
+    {
+        iJob = Vec_IntEntry( p->vQueue, i );
+        if ( Vec_IntEntry(Hsh_VecReadEntry(p->pJobs, iJob), 0) == iCnf )
+        {
+            Vec_IntWriteEntry( p->vStatus, iJob, SAT_SERVICE_CANCELED );
+            p->nCanceled++;
+        }
+        else
+            Vec_IntWriteEntry( p->vQueue, k++, iJob );
+    }
+    Vec_IntShrink( p->vQueue, k );
+    Sat_ServiceUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the CNF to the service.]
+
+  Description [The CNF is given as in Cnf_Dat_t: clause i spans the literals
+  from pClauses[i] to pClauses[i+1]. Returns the CNF ID, which is the same
+  for the CNFs with identical clauses. If the tables exceed the memory
+  limit and no job is waiting or running, they are cleared first, which 
+  invalidates the IDs returned earlier.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ServiceAddCnf( Sat_Service_t * p, int nVars, int nClauses, int ** pClauses )
+{
+    Vec_Int_t * vKey;
+    int i, iCnf;
+    vKey = Vec_IntAlloc( 1 + nClauses + (int)(pClauses[nClauses] - pClauses[0]) );
+    Vec_IntPush( vKey, nVars );
+    for ( i = 0; i < nClauses; i++ )
+    {
+        Vec_IntPush( vKey, (int)(pClauses[i+1] - pClauses[i]) );
+        Vec_IntPushArray( vKey, pClauses[i], (int)(pClauses[i+1] - pClauses[i]) );
+    }
+    Sat_ServiceLock( p );
+    if ( p->nMemLimit && Sat_ServiceMemory(p) > (double)p->nMemLimit * (1<<20) && p->iQueue == Vec_IntSize(p->vQueue) && p->nRunning == 0 )
+        Sat_ServiceReset( p );
+    iCnf = Hsh_VecManAdd( p->pCnfs, vKey );
+    p->nCnfs++;
+    Sat_ServiceUnlock( p );
+    Vec_IntFree( vKey );
+    return iCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits the job and returns its ID.]
+
+  Description [The job is to solve the CNF under the assumptions with the
+  given conflict limit (0 = no limit). If the same job was submitted
+  before, its ID is returned and the job is not solved again.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ServiceSubmit( Sat_Service_t * p, int iCnf, int * pLits, int nLits, int nConfLimit )
+{
+    Vec_Int_t * vKey = Vec_IntAlloc( nLits + 2 );
+    int iJob;
+    Vec_IntPushTwo( vKey, iCnf, nConfLimit );
+    Vec_IntPushArray( vKey, pLits, nLits );
+    Sat_ServiceLock( p );
+    assert( iCnf >= 0 && iCnf < Hsh_VecSize(p->pCnfs) );
+    iJob = Hsh_VecManAdd( p->pJobs, vKey );
+    p->nSubmits++;
+    if ( iJob < Vec_IntSize(p->vStatus) && Vec_IntEntry(p->vStatus, iJob) != SAT_SERVICE_CANCELED )
+        p->nHits++;
+    else
+    {
+        if ( iJob == Vec_IntSize(p->vStatus) )
+        {
+            Vec_IntPush( p->vStatus, SAT_SERVICE_PENDING );
+            Vec_PtrPush( p->vModels, NULL );
+        }
+        else
+            Vec_IntWriteEntry( p->vStatus, iJob, SAT_SERVICE_PENDING );
+        Vec_IntPush( p->vQueue, iJob );
+#ifdef ABC_USE_PTHREADS
+        pthread_cond_broadcast( &p->Cond );
+#endif
+    }
+    Sat_ServiceUnlock( p );
+    Vec_IntFree( vKey );
+    return iJob;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the job to be solved.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT), or 0 (undecided or canceled).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ServiceWait( Sat_Service_t * p, int iJob )
+{
+    int status;
+    Sat_ServiceLock( p );
+#ifdef ABC_USE_PTHREADS
+    while ( Vec_IntEntry(p->vStatus, iJob) >= SAT_SERVICE_PENDING )
+        pthread_cond_wait( &p->Cond, &p->Mutex );
+#else
+    while ( Vec_IntEntry(p->vStatus, iJob) >= SAT_SERVICE_PENDING )
+        Sat_ServiceSolveNext( p, p->Workers );
+#endif
+    status = Vec_IntEntry( p->vStatus, iJob );
+    Sat_ServiceUnlock( p );
+    return status == SAT_SERVICE_CANCELED ? 0 : status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the value of the variable in the model of the job.]
+
+  Description [The job should be solved and satisfiable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ServiceValue( Sat_Service_t * p, int iJob, int iVar )
+{
+    Vec_Str_t * vModel;
+    int Value;
+    Sat_ServiceLock( p );
+    assert( Vec_IntEntry(p->vStatus, iJob) == 1 );
+    vModel = (Vec_Str_t *)Vec_PtrEntry( p->vModels, iJob );
+    Value = iVar < Vec_StrSize(vModel) ? (int)Vec_StrEntry(vModel, iVar) : 0;
+    Sat_ServiceUnlock( p );
+    return Value;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reports the service.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sat_ServiceThreadNum( Sat_Service_t * p )
+{
+    return p->nThreads;
+}
+void Sat_ServicePrintStats( Sat_Service_t * p )
+{
+    int i, nLoads = 0;
+    Sat_ServiceLock( p );
+    for ( i = 0; i < p->nThreads; i++ )
+        nLoads += p->Workers[i].nLoads;
+    printf( "SAT service: Workers = %d. Solver = %s.  ", p->nThreads, Sat_BackendTypeName(p->SolverType) );
+    printf( "CNFs = %d (unique %d). Loads = %d.\n", p->nCnfs, Hsh_VecSize(p->pCnfs), nLoads );
+    printf( "Jobs = %d (cached %d). Solved = %d (SAT = %d. UNSAT = %d. Undec = %d). Canceled = %d. Waiting = %d.  ",
+        p->nSubmits, p->nHits, p->nSolved[0] + p->nSolved[1] + p->nSolved[2], p->nSolved[2], p->nSolved[0], p->nSolved[1],
+        p->nCanceled, Vec_IntSize(p->vQueue) - p->iQueue );
+    printf( "Mem = %.2f MB (limit %d MB). Clears = %d.\n", Sat_ServiceMemory(p) / (1<<20), p->nMemLimit, p->nClears );
+    Sat_ServiceUnlock( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The service shared by the frames of the process.]
+
+  Description [Setting the new service stops the previous one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sat_Service_t * Sat_ServiceGlobal( void )
+{
+    return s_pSatService;
+}
+void Sat_ServiceSetGlobal( Sat_Service_t * p )
+{
+    if ( s_pSatService && s_pSatService != p )
+        Sat_ServiceStop( s_pSatService );
+    s_pSatService = p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,76 @@
+/**CFile****************************************************************
+
+  FileName    [satService.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT solvers.]
+
+  Synopsis    [In-process SAT solving service shared by the commands.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 16, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#ifndef ABC__sat__bsat__satService_h
+#define ABC__sat__bsat__satService_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+#define SAT_SERVICE_THR_MAX 64
+#define SAT_SERVICE_MEM_MAX 1024    // the default memory limit of the tables in MB
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the service keeps a table of CNFs and a table of jobs (CNF + conflict limit
+// + assumptions); both are deduplicated, so a job submitted twice is solved
+// once and the second submission reads the cached result; the jobs are solved
+// by a fixed pool of workers, each keeping its solver loaded with the CNF of
+// the last job, so that jobs over the same CNF are solved incrementally; when
+// the tables exceed the memory limit, they are cleared before the next CNF
+typedef struct Sat_Service_t_ Sat_Service_t;
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== satService.c ==========================================================*/
+extern Sat_Service_t *  Sat_ServiceStart( int nThreads, int SolverType, int nMemLimit );
+extern void             Sat_ServiceStop( Sat_Service_t * p );
+extern void             Sat_ServiceClear( Sat_Service_t * p );
+extern void             Sat_ServiceCancel( Sat_Service_t * p, int iCnf );
+extern int              Sat_ServiceAddCnf( Sat_Service_t * p, int nVars, int nClauses, int ** pClauses );
+extern int              Sat_ServiceSubmit( Sat_Service_t * p, int iCnf, int * pLits, int nLits, int nConfLimit );
+extern int              Sat_ServiceWait( Sat_Service_t * p, int iJob );
+extern int              Sat_ServiceValue( Sat_Service_t * p, int iJob, int iVar );
+extern int              Sat_ServiceThreadNum( Sat_Service_t * p );
+extern void             Sat_ServicePrintStats( Sat_Service_t * p );
+extern Sat_Service_t *  Sat_ServiceGlobal( void );
+extern void             Sat_ServiceSetGlobal( Sat_Service_t * p );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
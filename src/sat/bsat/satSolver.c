@@ -133,6 +133,12 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// the watch of a binary clause is one entry (the other literal, see clause_from_lit())
+// the watch of a longer clause is two entries (the clause handle and a blocker literal);
+// the blocker is a literal of the clause; if it is true, the clause is not visited
+static inline int      sat_solver_watch_size(cla h)                  { return clause_is_lit(h) ? 1 : 2;     }
+static inline void     sat_solver_watch_push(veci* v, cla h, lit blk){ veci_push(v, h); veci_push(v, blk); }
+
 //=================================================================================================
 // Variable order functions:
 
@@ -587,8 +593,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(begin[0])), h, begin[1]);
+        sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(begin[1])), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -1077,9 +1091,22 @@ int sat_solver_propagate(sat_solver* s)
                     while (i < end)
                         *j++ = *i++;
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit* stop;
+                lit* k;
+
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(i[1])) == lit_sign(i[1])){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1091,34 +1118,42 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
-                else{
-                    // Look for new watch:
-                    lit* stop = lits + clause_size(c);
-                    lit* k;
-                    for (k = lits + 2; k < stop; k++){
-                        if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
-                            lits[1] = *k;
-                            *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
-                            goto next; }
-                    }
+                    *j++ = lits[0];
+                    i += 2;
+                    continue;
+                }
 
-                    *j++ = *i;
-                    // Clause is unit under assignment:
-                    if ( c->lrn )
-                        c->lbd = sat_clause_compute_lbd(s, c);
-                    if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
-                        // Copy the remaining watches:
-                        while (i < end)
-                            *j++ = *i++;
-                    }
+                // Look for new watch:
+                stop = lits + clause_size(c);
+                for (k = lits + 2; k < stop; k++){
+                    if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
+                        lits[1] = *k;
+                        *k = false_lit;
+                        sat_solver_watch_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i,lits[0]);
+                        break; }
                 }
+                if (k < stop){
+                    i += 2;
+                    continue;
+                }
+
+                *j++ = *i;
+                *j++ = lits[0];
+                // Clause is unit under assignment:
+                if ( c->lrn )
+                    c->lbd = sat_clause_compute_lbd(s, c);
+                if (!sat_solver_enqueue(s,lits[0], *i)){
+                    hConfl = *i;
+                    i += 2;
+                    // Copy the remaining watches:
+                    while (i < end)
+                        *j++ = *i++;
+                }
+                else
+                    i += 2;
             }
-        next:
-            i++;
         }
 
         s->stats.inspects += j - veci_begin(ws);
@@ -1159,6 +1194,7 @@ sat_solver* sat_solver_new(void)
 //    veci_new(&s->model);
     veci_new(&s->unit_lits);
     veci_new(&s->temp_clause);
+    veci_new(&s->assump_kept);
     veci_new(&s->conf_final);
 
     // initialize arrays
@@ -1224,6 +1260,7 @@ sat_solver* zsat_solver_new_seed(double seed)
 //    veci_new(&s->model);
     veci_new(&s->unit_lits);
     veci_new(&s->temp_clause);
+    veci_new(&s->assump_kept);
     veci_new(&s->conf_final);
 
     // initialize arrays
@@ -1355,6 +1392,7 @@ void sat_solver_delete(sat_solver* s)
     veci_delete(&s->unit_lits);
     veci_delete(&s->pivot_vars);
     veci_delete(&s->temp_clause);
+    veci_delete(&s->assump_kept);
     veci_delete(&s->conf_final);
 
     veci_delete(&s->user_vars);
@@ -1396,6 +1434,7 @@ void sat_solver_restart( sat_solver* s )
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
+    veci_resize(&s->assump_kept, 0);
     for ( i = 0; i < s->size*2; i++ )
         s->wlists[i].size = 0;
 
@@ -1442,6 +1481,7 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
 
     veci_resize(&s->trail_lim, 0);
     veci_resize(&s->order, 0);
+    veci_resize(&s->assump_kept, 0);
     for ( i = 0; i < s->size*2; i++ )
         s->wlists[i].size = 0;
 
@@ -1514,6 +1554,8 @@ double sat_solver_memory( sat_solver* s )
 
 int sat_solver_simplify(sat_solver* s)
 {
+    if ( veci_size(&s->assump_kept) )
+        sat_solver_solve_release(s);
     assert(sat_solver_dl(s) == 0);
     if (sat_solver_propagate(s) != 0)
         return false;
@@ -1577,6 +1619,8 @@ void sat_solver_reducedb(sat_solver* s)
         else // delete
         {
             c->mark = 1;
+            if ( s->pStore )
+                Sto_ManDeleteClause( (Sto_Man_t *)s->pStore, clause_begin(c), clause_begin(c) + clause_size(c) );
             s->stats.learnts_literals -= clause_size(c);
             s->stats.learnts--;
         }
@@ -1608,17 +1652,23 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1646,6 +1696,8 @@ void sat_solver_rollback( sat_solver* s )
     int i, k, j;
     static int Count = 0;
     Count++;
+    if ( veci_size(&s->assump_kept) )
+        sat_solver_solve_release(s);
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
     assert( s->iTrailPivot >= 0 && s->iTrailPivot <= s->qtail );
     // reset implication queue
@@ -1672,7 +1724,7 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) )
             {
@@ -1680,7 +1732,10 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -1738,6 +1793,8 @@ int sat_solver_addclause(sat_solver* s, lit* begin, lit* end)
     int maxvar;
     lit last;
     assert( begin < end );
+    if ( veci_size(&s->assump_kept) )
+        sat_solver_solve_release(s);
     if ( s->fPrintClause )
     {
         for ( i = begin; i < end; i++ )
@@ -1983,6 +2040,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2085,6 +2144,8 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
     if ( s->fVerbose )
         printf( "Running SAT solver with parameters %d and %d and %d.\n", s->nLearntStart, s->nLearntDelta, s->nLearntRatio );
 
+    if ( veci_size(&s->assump_kept) )
+        sat_solver_solve_release(s);
     sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
 
 #ifdef SAT_USE_ANALYZE_FINAL
@@ -2134,6 +2195,57 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
     return status;
 }
 
+// This procedure solves under assumptions, which are left on the trail after the call.
+// The next call reuses the assumptions of the longest common prefix of the two sets
+// instead of pushing and propagating them again, which speeds up the sequences of 
+// queries with the same leading assumptions (for example, in SAT-based resubstitution).
+// The assumptions are released by sat_solver_solve_release(), which is also called
+// automatically before adding clauses or calling other solving procedures.
+// They are also released when the call returns l_False, because the conflict 
+// found under the assumptions may be left unresolved on the trail.
+int sat_solver_solve_reuse(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit)
+{
+    lit * pKept = veci_begin(&s->assump_kept);
+    int i, status, nKept = veci_size(&s->assump_kept);
+    assert( s->pStore == NULL );
+    assert( s->root_level == nKept && sat_solver_dl(s) == nKept );
+    if ( s->fSolved )
+        return l_False;
+    sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, 0, 0 );
+    // find the common prefix
+    for ( i = 0; i < nKept && begin + i < end; i++ )
+        if ( pKept[i] != begin[i] )
+            break;
+    s->nAssumpReused += i;
+    // undo the remaining assumptions
+    while ( veci_size(&s->assump_kept) > i )
+    {
+        veci_pop(&s->assump_kept);
+        sat_solver_pop(s);
+    }
+    // add the new assumptions
+    for ( ; begin + i < end; i++ )
+    {
+        if ( !sat_solver_push(s, begin[i]) )
+        {
+            sat_solver_solve_release(s);
+            return l_False;
+        }
+        veci_push(&s->assump_kept, begin[i]);
+    }
+    status = sat_solver_solve_internal(s);
+    if ( status == l_False )
+        sat_solver_solve_release(s);
+    return status;
+}
+
+void sat_solver_solve_release(sat_solver* s)
+{
+    sat_solver_canceluntil(s, 0);
+    s->root_level = 0;
+    veci_resize(&s->assump_kept, 0);
+}
+
 // This LEXSAT procedure should be called with a set of literals (pLits, nLits),
 // which defines both (1) variable order, and (2) assignment to begin search from.
 // It retuns the LEXSAT assigment that is the same or larger than the given one.
@@ -2392,6 +2504,12 @@ void sat_solver_store_alloc( sat_solver * s )
     s->pStore = Sto_ManAlloc();
 }
 
+int sat_solver_store_trace( sat_solver * s )
+{
+    assert( s->pStore != NULL );
+    return Sto_ManStartTrace( (Sto_Man_t *)s->pStore );
+}
+
 void sat_solver_store_write( sat_solver * s, char * pFileName )
 {
     if ( s->pStore ) Sto_ManDumpClauses( (Sto_Man_t *)s->pStore, pFileName );
@@ -54,6 +54,8 @@ extern int         sat_solver_minimize_assumptions( sat_solver* s, int * pLits,
 extern int         sat_solver_minimize_assumptions2( sat_solver* s, int * pLits, int nLits, int nConfLimit );
 extern int         sat_solver_push(sat_solver* s, int p);
 extern void        sat_solver_pop(sat_solver* s);
+extern int         sat_solver_solve_reuse(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit);
+extern void        sat_solver_solve_release(sat_solver* s);
 extern void        sat_solver_set_resource_limits(sat_solver* s, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, ABC_INT64_T nConfLimitGlobal, ABC_INT64_T nInsLimitGlobal);
 extern void        sat_solver_restart( sat_solver* s );
 extern void        zsat_solver_restart_seed( sat_solver* s, double seed );
@@ -82,6 +84,7 @@ extern void        Sat_SolverTraceWrite( sat_solver * pSat, int * pBeg, int * pE
 
 // clause storage
 extern void        sat_solver_store_alloc( sat_solver * s );
+extern int         sat_solver_store_trace( sat_solver * s );
 extern void        sat_solver_store_write( sat_solver * s, char * pFileName );
 extern void        sat_solver_store_free( sat_solver * s );
 extern void        sat_solver_store_mark_roots( sat_solver * s );
@@ -194,6 +197,8 @@ struct sat_solver_t
     int         nRoots;
 
     veci        temp_clause;    // temporary storage for a CNF clause
+    veci        assump_kept;    // assumptions left on the trail by sat_solver_solve_reuse()
+    int         nAssumpReused;  // the number of assumptions not pushed again
 
     // assignment storage
     veci        user_vars;      // variable IDs
@@ -206,6 +211,7 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +367,10 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
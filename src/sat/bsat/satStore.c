@@ -32,6 +32,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static void Sto_ManTraceWrite( Sto_Man_t * p, lit * pBeg, lit * pEnd, int fDelete );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -142,6 +144,9 @@ Sto_Man_t * Sto_ManAlloc()
 ***********************************************************************/
 void Sto_ManFree( Sto_Man_t * p )
 {
+    if ( p->pTrace )
+        fclose( p->pTrace );
+    ABC_FREE( p->pBuffer );
     Sto_ManMemoryStop( p );
     ABC_FREE( p );
 }
@@ -185,6 +190,15 @@ int Sto_ManAddClause( Sto_Man_t * p, lit * pBeg, lit * pEnd )
         p->nVars = STO_MAX( p->nVars, lit_var(*(pEnd-1)) + 1 );
     }
 
+    // stream the learned clause into the trace
+    if ( p->pTrace && p->nRoots > 0 && pBeg < pEnd )
+    {
+        Sto_ManTraceWrite( p, pBeg, pEnd, 0 );
+        p->nClauses++;
+        p->nTraced++;
+        return 1;
+    }
+
     // get memory for the clause
     nSize = sizeof(Sto_Cls_t) + sizeof(lit) * (pEnd - pBeg);
     nSize = (nSize / sizeof(char*) + ((nSize % sizeof(char*)) > 0)) * sizeof(char*); // added by Saurabh on Sep 3, 2009
@@ -221,6 +235,190 @@ int Sto_ManAddClause( Sto_Man_t * p, lit * pBeg, lit * pEnd )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts streaming learned clauses into a temporary file.]
+
+  Description [After this call, the non-empty clauses added after 
+  Sto_ManMarkRoots() are not kept in memory but written into the trace
+  as compact records: the literal count and the deletion flag followed 
+  by the sorted literals in the delta-encoded form. The clauses deleted 
+  by the solver are recorded using Sto_ManDeleteClause(), which allows 
+  the proof processing to keep only the live clauses. The clause IDs 
+  are assigned as if the clauses were stored in memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sto_ManStartTrace( Sto_Man_t * p )
+{
+    assert( p->pTrace == NULL );
+    p->pTrace = tmpfile();
+    if ( p->pTrace == NULL )
+    {
+        printf( "Sto_ManStartTrace(): Cannot open a temporary file for the proof trace.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one record into the trace.]
+
+  Description [The literals are expected to be sorted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Sto_ManTraceWriteUint( FILE * pFile, unsigned x )
+{
+    while ( x & ~0x7f )
+    {
+        putc( (int)((x & 0x7f) | 0x80), pFile );
+        x >>= 7;
+    }
+    putc( (int)x, pFile );
+}
+static void Sto_ManTraceWrite( Sto_Man_t * p, lit * pBeg, lit * pEnd, int fDelete )
+{
+    lit * i;
+    Sto_ManTraceWriteUint( p->pTrace, ((unsigned)(pEnd - pBeg) << 1) | (fDelete != 0) );
+    for ( i = pBeg; i < pEnd; i++ )
+        Sto_ManTraceWriteUint( p->pTrace, (unsigned)(i == pBeg ? *i : *i - *(i-1)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the deletion of a learned clause.]
+
+  Description [Does nothing unless the learned clauses are streamed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManDeleteClause( Sto_Man_t * p, lit * pBeg, lit * pEnd )
+{
+    lit Lit, * i, * j;
+    int nLits = pEnd - pBeg;
+    if ( p->pTrace == NULL || p->nRoots == 0 || nLits == 0 )
+        return;
+    if ( p->nBufferAlloc < nLits )
+    {
+        p->nBufferAlloc = STO_MAX( 2 * p->nBufferAlloc, nLits );
+        p->pBuffer = ABC_REALLOC( lit, p->pBuffer, p->nBufferAlloc );
+    }
+    memcpy( p->pBuffer, pBeg, sizeof(lit) * nLits );
+    // insertion sort
+    for ( i = p->pBuffer + 1; i < p->pBuffer + nLits; i++ )
+    {
+        Lit = *i;
+        for ( j = i; j > p->pBuffer && *(j-1) > Lit; j-- )
+            *j = *(j-1);
+        *j = Lit;
+    }
+    Sto_ManTraceWrite( p, p->pBuffer, p->pBuffer + nLits, 1 );
+    p->nTraceDels++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the size of the trace in bytes.]
+
+  Description [The size is 64-bit because the trace may exceed 2 GB.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_INT64_T Sto_ManTraceSize( Sto_Man_t * p )
+{
+    if ( p->pTrace == NULL )
+        return 0;
+#ifdef _WIN32
+    return (ABC_INT64_T)_ftelli64( p->pTrace );
+#else
+    return (ABC_INT64_T)ftello( p->pTrace );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the trace for reading.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sto_ManTraceRewind( Sto_Man_t * p )
+{
+    assert( p->pTrace != NULL );
+    fflush( p->pTrace );
+    rewind( p->pTrace );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next record from the trace.]
+
+  Description [Returns the number of literals, which are stored in 
+  p->pBuffer, or -1 when the end of the trace is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sto_ManTraceReadUint( FILE * pFile, unsigned * px )
+{
+    unsigned x = 0;
+    int c, i = 0;
+    while ( (c = getc(pFile)) != EOF )
+    {
+        x |= (unsigned)(c & 0x7f) << (7 * i++);
+        if ( (c & 0x80) == 0 )
+        {
+            *px = x;
+            return 1;
+        }
+    }
+    return 0;
+}
+int Sto_ManTraceReadClause( Sto_Man_t * p, int * pfDelete )
+{
+    unsigned Header, Entry;
+    int k, nLits;
+    if ( !Sto_ManTraceReadUint( p->pTrace, &Header ) )
+        return -1;
+    nLits = (int)(Header >> 1);
+    *pfDelete = (int)(Header & 1);
+    if ( p->nBufferAlloc < nLits )
+    {
+        p->nBufferAlloc = STO_MAX( 2 * p->nBufferAlloc, nLits );
+        p->pBuffer = ABC_REALLOC( lit, p->pBuffer, p->nBufferAlloc );
+    }
+    for ( k = 0; k < nLits; k++ )
+    {
+        if ( !Sto_ManTraceReadUint( p->pTrace, &Entry ) )
+        {
+            printf( "Sto_ManTraceReadClause(): The proof trace is truncated.\n" );
+            return -1;
+        }
+        p->pBuffer[k] = (lit)(k ? p->pBuffer[k-1] + Entry : Entry);
+    }
+    return nLits;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Mark all clauses added so far as root clauses.]
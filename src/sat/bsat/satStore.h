@@ -89,6 +89,12 @@ struct Sto_Man_t_
     Sto_Cls_t *     pHead;        // the head clause
     Sto_Cls_t *     pTail;        // the tail clause
     Sto_Cls_t *     pEmpty;       // the empty clause
+    // streaming of learned clauses
+    FILE *          pTrace;       // the trace of learned and deleted clauses (or NULL)
+    int             nTraced;      // the number of learned clauses in the trace
+    int             nTraceDels;   // the number of deleted clauses in the trace
+    lit *           pBuffer;      // the literals of the last clause read from the trace
+    int             nBufferAlloc; // the number of literals allocated in the buffer
     // memory management
     int             nChunkSize;   // the number of bytes in a chunk
     int             nChunkUsed;   // the number of bytes used in the last chunk
@@ -117,6 +123,11 @@ extern void         Sto_ManMarkClausesA( Sto_Man_t * p );
 extern void         Sto_ManDumpClauses( Sto_Man_t * p, char * pFileName );
 extern int          Sto_ManChangeLastClause( Sto_Man_t * p );
 extern Sto_Man_t *  Sto_ManLoadClauses( char * pFileName );
+extern int          Sto_ManStartTrace( Sto_Man_t * p );
+extern void         Sto_ManDeleteClause( Sto_Man_t * p, lit * pBeg, lit * pEnd );
+extern ABC_INT64_T  Sto_ManTraceSize( Sto_Man_t * p );
+extern void         Sto_ManTraceRewind( Sto_Man_t * p );
+extern int          Sto_ManTraceReadClause( Sto_Man_t * p, int * pfDelete );
 
 
 /*=== satInter.c ==========================================================*/
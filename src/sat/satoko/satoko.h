@@ -119,6 +119,12 @@ extern void satoko_unbookmark(satoko_t *);
  */
 extern int satoko_final_conflict(satoko_t *, int **);
 
+/* Returns the literals assigned at the top level (decision level zero).
+ *  - The memory for the array is managed by the solver; it remains valid
+ * until the next call to the solver.
+ */
+extern int satoko_read_units(satoko_t *, int **);
+
 /* Procedure to dump a DIMACS file.
  * - It receives as input the solver, a file name string and two integers.
  * - If the file name string is NULL the solver will dump in stdout.
@@ -430,6 +430,12 @@ int satoko_final_conflict(solver_t *s, int **out)
     return vec_uint_size(s->final_conflict);
 }
 
+int satoko_read_units(solver_t *s, int **out)
+{
+    *out = (int *)vec_uint_data(s->trail);
+    return solver_dlevel(s) ? (int)vec_uint_at(s->trail_lim, 0) : (int)vec_uint_size(s->trail);
+}
+
 satoko_stats_t * satoko_stats(satoko_t *s)
 {
     return &s->stats;
@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/bmc/bmc.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +53,241 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, SimulatesTheSameWithManyThreads) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int i, nCis = 40, nWords = 100;
+  Abc_Random(1);
+  for (i = 0; i < nCis; i++)
+    Gia_ManAppendCi(aig_manager);
+  for (i = 0; i < 500; i++) {
+    int nObjs = Gia_ManObjNum(aig_manager);
+    int iVar0 = 1 + Abc_Random(0) % (nObjs - 1);
+    int iVar1 = 1 + Abc_Random(0) % (nObjs - 1);
+    if (iVar0 == iVar1)
+      iVar1 = iVar0 == 1 ? 2 : iVar0 - 1;
+    Gia_ManAppendAnd(aig_manager, Abc_Var2Lit(iVar0, Abc_Random(0) & 1), Abc_Var2Lit(iVar1, Abc_Random(0) & 1));
+  }
+  for (i = 0; i < 10; i++)
+    Gia_ManAppendCo(aig_manager, Abc_Var2Lit(Gia_ManObjNum(aig_manager) - 1 - 7 * i, i & 1));
+
+  // the word count is not a multiple of the simulation block
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(nCis * nWords);
+  for (int fOuts = 0; fOuts < 2; fOuts++) {
+    Vec_Wrd_t* single = Gia_ManSimPatSimOut(aig_manager, stimulus, fOuts);
+    for (int nProcs = 2; nProcs <= 8; nProcs *= 2) {
+      Vec_Wrd_t* multi = Vec_WrdAlloc(0);
+      Gia_ManSimPatSimMt(aig_manager, stimulus, multi, fOuts, nProcs);
+      ASSERT_EQ(Vec_WrdSize(multi), Vec_WrdSize(single));
+      EXPECT_EQ(memcmp(Vec_WrdArray(multi), Vec_WrdArray(single), sizeof(word) * Vec_WrdSize(single)), 0);
+      Vec_WrdFree(multi);
+    }
+    Vec_WrdFree(single);
+  }
+  Vec_WrdFree(stimulus);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanExtendLoadedSnapshot) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, input1, input2));
+  char file_name[] = "gia_test_snapshot.snap";
+  ASSERT_EQ(Gia_ManSnapWrite(aig_manager, file_name, 0), 1);
+  Gia_ManStop(aig_manager);
+
+  ASSERT_TRUE(Gia_ManSnapIsFile(file_name));
+  Gia_Man_t* loaded = Gia_ManSnapRead(file_name, 0);
+  ASSERT_TRUE(loaded != NULL);
+  EXPECT_EQ(Gia_ManCiNum(loaded), 2);
+  EXPECT_EQ(Gia_ManCoNum(loaded), 1);
+  EXPECT_EQ(Gia_ManAndNum(loaded), 1);
+
+  // the object array is full, so the next object moves it out of the snapshot
+  int and_output = Gia_ManAppendAnd(loaded, Gia_ManCiLit(loaded, 0), Abc_LitNot(Gia_ManCiLit(loaded, 1)));
+  Gia_ManAppendCo(loaded, and_output);
+  EXPECT_EQ(Gia_ManAndNum(loaded), 2);
+  EXPECT_EQ(Gia_ManCoNum(loaded), 2);
+  Gia_ManStop(loaded);
+  remove(file_name);
+}
+
+TEST(GiaTest, CanWriteSnapshotOverLoadedFile) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, input1, input2));
+  char file_name[] = "gia_test_snapshot_over.snap";
+  ASSERT_EQ(Gia_ManSnapWrite(aig_manager, file_name, 0), 1);
+  Gia_ManStop(aig_manager);
+
+  // the loaded AIG keeps its objects in the file, which is replaced by the write
+  Gia_Man_t* loaded = Gia_ManSnapRead(file_name, 0);
+  ASSERT_TRUE(loaded != NULL);
+  ASSERT_EQ(Gia_ManSnapWrite(loaded, file_name, 0), 1);
+  EXPECT_EQ(Gia_ManAndNum(loaded), 1);
+  EXPECT_EQ(Gia_ObjFaninId1p(loaded, Gia_ObjFanin0(Gia_ManCo(loaded, 0))), 2);
+
+  Gia_Man_t* reloaded = Gia_ManSnapRead(file_name, 0);
+  ASSERT_TRUE(reloaded != NULL);
+  EXPECT_EQ(Gia_ManCiNum(reloaded), 2);
+  EXPECT_EQ(Gia_ManCoNum(reloaded), 1);
+  EXPECT_EQ(Gia_ManAndNum(reloaded), 1);
+  Gia_ManStop(reloaded);
+  Gia_ManStop(loaded);
+  remove(file_name);
+}
+
+TEST(GiaTest, CanCleanupInPlace) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int input3 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendAnd(aig_manager, input1, input2);  // dangling
+  int and_output = Gia_ManAppendAnd(aig_manager, input2, Abc_LitNot(input3));
+  Gia_ManAppendCo(aig_manager, and_output);
+
+  Vec_Int_t* map = Gia_ManCleanupInPlace(aig_manager);
+  ASSERT_TRUE(map != NULL);
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 1);
+  EXPECT_EQ(Vec_IntEntry(map, Abc_Lit2Var(and_output)), 4);
+  Gia_Obj_t* pAnd = Gia_ObjFanin0(Gia_ManCo(aig_manager, 0));
+  EXPECT_EQ(Gia_ObjFaninId0p(aig_manager, pAnd), 2);
+  EXPECT_EQ(Gia_ObjFaninId1p(aig_manager, pAnd), 3);
+  EXPECT_EQ(Gia_ObjFaninC1(pAnd), 1);
+  Vec_IntFree(map);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, DoesNotCleanupInPlaceWithObjectData) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendAnd(aig_manager, input1, input2);  // dangling
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, input1, Abc_LitNot(input2)));
+
+  // the dominators are indexed by object IDs and would not be remapped
+  aig_manager->vDoms = Vec_IntStartFull(Gia_ManObjNum(aig_manager));
+  EXPECT_FALSE(Gia_ManCanCompactInPlace(aig_manager));
+  EXPECT_TRUE(Gia_ManCleanupInPlace(aig_manager) == NULL);
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 2);
+  Vec_IntFreeP(&aig_manager->vDoms);
+  EXPECT_TRUE(Gia_ManCanCompactInPlace(aig_manager));
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanKeepStaticFanout) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(4);
+  Gia_ManStaticFanoutKeepStart(aig_manager);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int and_output = input2;
+  for (int i = 0; i < 20; i++)
+    and_output = Gia_ManAppendAnd(aig_manager, input1, and_output);
+  Gia_ManAppendCo(aig_manager, and_output);
+
+  // the fanout is updated as the objects are added, so it does not need to be started
+  ASSERT_TRUE(aig_manager->vFanoutNums != NULL);
+  EXPECT_EQ(aig_manager->nFanoutObjs, Gia_ManObjNum(aig_manager));
+  EXPECT_EQ(Gia_ObjFanoutNumId(aig_manager, 1), 20);
+  for (int i = 0; i < 20; i++)
+    EXPECT_EQ(Gia_ObjFanoutId(aig_manager, 1, i), 3 + i);
+  EXPECT_EQ(Gia_ObjFanoutNumId(aig_manager, 2), 1);
+  EXPECT_EQ(Gia_ObjFanoutId(aig_manager, 22, 0), 23);
+
+  // the fanout survives the stop and is rebuilt after the objects are changed in place
+  Gia_ManStaticFanoutStop(aig_manager);
+  ASSERT_TRUE(aig_manager->vFanoutNums != NULL);
+  Gia_ManPatchCoDriver(aig_manager, 0, input2);
+  EXPECT_TRUE(aig_manager->vFanoutNums == NULL);
+  Gia_ManStaticFanoutStart(aig_manager);
+  EXPECT_EQ(Gia_ObjFanoutNumId(aig_manager, 2), 2);
+  EXPECT_EQ(Gia_ObjFanoutNumId(aig_manager, 22), 0);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(SatSolverTest, DoesNotReuseConflictingAssumptions) {
+  // a = 0 follows from the first four clauses, b = 1 from the last one
+  int a = 0, x = 1, y = 2, b = 3;
+  int clauses[5][3] = {
+    { Abc_Var2Lit(a, 1), Abc_Var2Lit(x, 0), Abc_Var2Lit(y, 0) },
+    { Abc_Var2Lit(a, 1), Abc_Var2Lit(x, 0), Abc_Var2Lit(y, 1) },
+    { Abc_Var2Lit(a, 1), Abc_Var2Lit(x, 1), Abc_Var2Lit(y, 0) },
+    { Abc_Var2Lit(a, 1), Abc_Var2Lit(x, 1), Abc_Var2Lit(y, 1) },
+    { Abc_Var2Lit(b, 0), Abc_Var2Lit(a, 0), -1 }
+  };
+  sat_solver* solver = sat_solver_new();
+  sat_solver_setnvars(solver, 4);
+  for (int i = 0; i < 5; i++)
+    ASSERT_TRUE(sat_solver_addclause(solver, clauses[i], clauses[i] + (i < 4 ? 3 : 2)));
+
+  int assumps[2] = { Abc_Var2Lit(a, 0), Abc_Var2Lit(b, 0) };
+  // the conflict found under the assumptions should not leak into the next calls
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps, assumps + 1, 0, 0), l_False);
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps, assumps + 2, 0, 0), l_False);
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps, assumps + 1, 0, 0), l_False);
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps + 1, assumps + 2, 0, 0), l_True);
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps, assumps + 2, 0, 0), l_False);
+  EXPECT_EQ(sat_solver_solve_reuse(solver, assumps, assumps + 1, 0, 0), l_False);
+  sat_solver_solve_release(solver);
+  sat_solver_delete(solver);
+}
+
+// a counter with an enable input; output i fails when the counter reaches Targets[i]
+static Gia_Man_t* BuildEnabledCounter(int nBits, const int* Targets, int nTargets) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  int i, k, Carry, iLit, Regs[16];
+  Gia_ManHashStart(p);
+  Carry = Gia_ManAppendCi(p);
+  for (k = 0; k < nBits; k++)
+    Regs[k] = Gia_ManAppendCi(p);
+  for (i = 0; i < nTargets; i++) {
+    for (iLit = 1, k = 0; k < nBits; k++)
+      iLit = Gia_ManHashAnd(p, iLit, Abc_LitNotCond(Regs[k], !((Targets[i] >> k) & 1)));
+    Gia_ManAppendCo(p, iLit);
+  }
+  for (k = 0; k < nBits; k++) {
+    Gia_ManAppendCo(p, Gia_ManHashXor(p, Regs[k], Carry));
+    Carry = Gia_ManHashAnd(p, Regs[k], Carry);
+  }
+  Gia_ManHashStop(p);
+  Gia_ManSetRegNum(p, nBits);
+  return p;
+}
+
+static int RunBmcs(Gia_Man_t* p, int nProcs, int nWinSize, int nFramesMax, int* pFrame, int* pOut) {
+  Bmc_AndPar_t Pars;
+  memset(&Pars, 0, sizeof(Bmc_AndPar_t));
+  Pars.nFramesMax  = nFramesMax;
+  Pars.nFramesAdd  = 1;
+  Pars.nProcs      = nProcs;
+  Pars.nWinSize    = nWinSize;
+  Pars.fNotVerbose = 1;
+  int RetValue = Bmcs_ManPerform(p, &Pars);
+  *pFrame = p->pCexSeq ? p->pCexSeq->iFrame : -1;
+  *pOut = p->pCexSeq ? p->pCexSeq->iPo : -1;
+  if (p->pCexSeq) {
+    EXPECT_TRUE(Gia_ManVerifyCex(p, p->pCexSeq, 0));
+  }
+  return RetValue;
+}
+
+TEST(BmcTest, WindowsFindTheSameFailureAsOneSolver) {
+  int Targets[2] = { 23, 13 };
+  int Windows[4][2] = { {2, 1}, {3, 2}, {4, 5}, {3, 4} };
+  Gia_Man_t* p = BuildEnabledCounter(5, Targets, 2);
+  for (int nFramesMax = 13; nFramesMax <= 30; nFramesMax += 17) {
+    int Frame, Out, FrameW, OutW;
+    int RetValue = RunBmcs(p, 1, 0, nFramesMax, &Frame, &Out);
+    EXPECT_EQ(RetValue, nFramesMax == 13 ? -1 : 0);
+    for (int i = 0; i < 4; i++) {
+      EXPECT_EQ(RunBmcs(p, Windows[i][0], Windows[i][1], nFramesMax, &FrameW, &OutW), RetValue);
+      EXPECT_EQ(FrameW, Frame);
+      EXPECT_EQ(OutW, Out);
+    }
+  }
+  Abc_CexFreeP(&p->pCexSeq);
+  Gia_ManStop(p);
+}
+
 ABC_NAMESPACE_IMPL_END